@@ -0,0 +1,349 @@
+#ifndef INCLUDE_TIMING_WHEEL_H_
+#define INCLUDE_TIMING_WHEEL_H_
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint64_t
+#include <new>      // for placement new
+#include <utility>  // for std::move
+#include <vector>
+
+/* A hierarchical timing wheel - millions of armed timers with O(1)
+ * schedule and cancel.
+ * Public interface:
+ * modifiers: schedule(), cancel(), advance(), clear()
+ * accessors: now()
+ * capacity:  empty(), size()
+ *
+ * Time is an integer tick count that only moves forward. The wheel
+ * has kLevels levels of kSlots slots; a timer sits at the level of
+ * the highest 8-bit digit in which its expiry differs from now(), in
+ * the slot named by that digit. Together the levels cover every
+ * 64-bit tick, so there is no overflow list. When now() enters the
+ * range of a higher-level slot, that slot is cascaded: its timers
+ * move down to the levels below. Each timer moves at most kLevels
+ * times in its life, and a bitmap of non-empty slots per level lets
+ * advance() jump straight to the next tick that has work.
+ *
+ * Each slot is an intrusive FIFO bucket of timerNodes, a doubly
+ * linked version of the queue/queueNode pair in queue.h, so timers
+ * due on the same tick expire in the order they were scheduled.
+ */
+
+typedef uint64_t tick_t;
+
+template <typename Element>
+class timingWheel;
+
+template <typename Element>
+class timerNode {
+ public:
+  friend class timingWheel<Element>;
+
+  // accessors
+  const Element& element() const {
+    return element_;
+  }
+
+  Element& element() {
+    return element_;
+  }
+
+  tick_t when() const {
+    return when_;
+  }
+
+ private:
+  Element element_;
+  tick_t when_;
+  timerNode* prev_;
+  timerNode* next_;
+
+  timerNode(tick_t when, const Element& element)
+      : element_{element}, when_{when}, prev_{nullptr}, next_{nullptr} {}
+  timerNode(tick_t when, Element&& element)
+      : element_{std::move(element)}, when_{when}, prev_{nullptr}, next_{nullptr} {}
+  // disable the default copy ctor and assignment operator:
+  const timerNode& operator=(const timerNode&);
+  timerNode(const timerNode&);
+};
+
+
+template <typename Element>
+class timingWheel {
+ public:
+  // A handle names an armed timer until it expires or is cancelled;
+  // after that it must not be used again.
+  typedef timerNode<Element>* handle;
+
+  explicit timingWheel(tick_t now = 0)
+      : size_{0}, now_{now}, free_{nullptr} {
+    for (int level = 0; level < kLevels; ++level) {
+      for (int word = 0; word < kWords; ++word) {
+        occupied_[level][word] = 0;
+      }
+      for (int slot = 0; slot < kSlots; ++slot) {
+        buckets_[level][slot].head_ = buckets_[level][slot].tail_ = nullptr;
+      }
+    }
+  }
+
+  ~timingWheel() {
+    clear();
+    for (size_t i = 0; i < chunks_.size(); ++i) {
+      ::operator delete(chunks_[i]);
+    }
+  }
+
+  // capacity methods:
+  size_t size() const {
+    return size_;
+  }
+
+  bool empty() const {
+    return size_ == 0;
+  }
+
+  // accessors methods:
+  tick_t now() const {
+    return now_;
+  }
+
+  // modifiers methods:
+  // arm a timer that expires at tick when; a tick at or before now()
+  // expires on the next advance()
+  handle schedule(tick_t when, const Element& element) {
+    Element copied_element = element;
+    return schedule(when, std::move(copied_element));
+  }
+
+  handle schedule(tick_t when, Element&& element) {
+    timerNode<Element>* node =
+        new (allocate()) timerNode<Element>(when < now_ ? now_ : when, std::move(element));
+    place(node);
+    size_++;
+    return node;
+  }
+
+  // disarm a timer that has not expired yet
+  void cancel(handle node) {
+    unlink(node);
+    release(node);
+    size_--;
+  }
+
+  // Move time forward to now, expiring every timer due at or before
+  // it. For each tick with expired timers, on_expire(tick, batch) is
+  // called with their elements in the order they were scheduled.
+  // It may schedule and cancel other timers, but not call advance();
+  // a timer it schedules at or before tick makes another batch for
+  // the same tick. Returns the number of timers expired.
+  template <typename Callback>
+  size_t advance(tick_t now, Callback on_expire) {
+    size_t expired = 0;
+    if (now < now_) {
+      return expired;
+    }
+    for (;;) {
+      for (size_t batch; (batch = expire(on_expire)) > 0; ) {
+        expired += batch;
+      }
+      int level = 0;
+      tick_t next = 0;
+      if (!nextEvent(&next, &level) || next > now) {
+        break;
+      }
+      now_ = next;
+      if (level > 0) {
+        cascade(level, digit(now_, level));
+      }
+    }
+    now_ = now;
+    return expired;
+  }
+
+  // cancel everything
+  void clear() {
+    for (int level = 0; level < kLevels; ++level) {
+      for (int slot = 0; slot < kSlots; ++slot) {
+        timerNode<Element>* node = buckets_[level][slot].head_;
+        while (node) {
+          timerNode<Element>* next = node->next_;
+          release(node);
+          node = next;
+        }
+        buckets_[level][slot].head_ = buckets_[level][slot].tail_ = nullptr;
+      }
+      for (int word = 0; word < kWords; ++word) {
+        occupied_[level][word] = 0;
+      }
+    }
+    size_ = 0;
+  }
+
+ private:
+  static const int kBits = 8;
+  static const int kSlots = 1 << kBits;
+  static const int kLevels = 64 / kBits;
+  static const int kWords = kSlots / 64;     // bitmap words per level
+  static const int kChunk = 4096;            // nodes per allocation
+
+  struct bucket {
+    timerNode<Element>* head_;
+    timerNode<Element>* tail_;
+  };
+
+  size_t size_;
+  tick_t now_;
+  bucket buckets_[kLevels][kSlots];
+  uint64_t occupied_[kLevels][kWords];     // bit set if the slot's bucket is non-empty
+  timerNode<Element>* free_;               // recycled nodes, chained by next_
+  std::vector<void*> chunks_;              // every block of nodes allocated
+  std::vector<Element> batch_;             // elements passed to on_expire
+
+  static int digit(tick_t t, int level) {
+    return (t >> (level * kBits)) & (kSlots - 1);
+  }
+
+  // the level of tick when relative to now_: the highest digit in
+  // which they differ, or 0 if they are equal
+  int levelOf(tick_t when) const {
+    tick_t diff = when ^ now_;
+    return diff == 0 ? 0 : (63 - __builtin_clzll(diff)) / kBits;
+  }
+
+  // append node to the FIFO bucket for its expiry
+  void place(timerNode<Element>* node) {
+    int level = levelOf(node->when_);
+    int slot = digit(node->when_, level);
+    bucket& b = buckets_[level][slot];
+    node->next_ = nullptr;
+    node->prev_ = b.tail_;
+    if (b.tail_) {
+      b.tail_->next_ = node;
+    } else {
+      b.head_ = node;
+      occupied_[level][slot / 64] |= uint64_t(1) << (slot % 64);
+    }
+    b.tail_ = node;
+  }
+
+  void unlink(timerNode<Element>* node) {
+    int level = levelOf(node->when_);
+    int slot = digit(node->when_, level);
+    bucket& b = buckets_[level][slot];
+    if (node->prev_) {
+      node->prev_->next_ = node->next_;
+    } else {
+      b.head_ = node->next_;
+    }
+    if (node->next_) {
+      node->next_->prev_ = node->prev_;
+    } else {
+      b.tail_ = node->prev_;
+    }
+    if (!b.head_) {
+      occupied_[level][slot / 64] &= ~(uint64_t(1) << (slot % 64));
+    }
+  }
+
+  // detach a whole bucket and return its first node
+  timerNode<Element>* take(int level, int slot) {
+    bucket& b = buckets_[level][slot];
+    timerNode<Element>* head = b.head_;
+    b.head_ = b.tail_ = nullptr;
+    occupied_[level][slot / 64] &= ~(uint64_t(1) << (slot % 64));
+    return head;
+  }
+
+  // the first occupied slot above slot at level, or -1
+  int nextSlot(int level, int slot) const {
+    int first = slot + 1;
+    if (first == kSlots) {
+      return -1;
+    }
+    int word = first / 64;
+    uint64_t bits = occupied_[level][word] & (~uint64_t(0) << (first % 64));
+    while (!bits) {
+      if (++word == kWords) {
+        return -1;
+      }
+      bits = occupied_[level][word];
+    }
+    return word * 64 + __builtin_ctzll(bits);
+  }
+
+  // Find the earliest tick after now_ at which a bucket comes due,
+  // and its level; false if the wheel is empty. Slots at level L lie
+  // in the current range of level L + 1, so the lowest level with an
+  // occupied slot holds it.
+  bool nextEvent(tick_t* next, int* level) const {
+    for (int l = 0; l < kLevels; ++l) {
+      int slot = nextSlot(l, digit(now_, l));
+      if (slot >= 0) {
+        int shift = l * kBits;
+        tick_t above = shift + kBits < 64 ? (now_ >> (shift + kBits)) << (shift + kBits) : 0;
+        *next = above | (tick_t(slot) << shift);
+        *level = l;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // spread a higher-level bucket over the levels below it; called
+  // when now_ has just reached the start of its range
+  void cascade(int level, int slot) {
+    timerNode<Element>* node = take(level, slot);
+    while (node) {
+      timerNode<Element>* next = node->next_;
+      place(node);
+      node = next;
+    }
+  }
+
+  // expire the level 0 bucket for now_
+  template <typename Callback>
+  size_t expire(Callback& on_expire) {
+    timerNode<Element>* node = take(0, digit(now_, 0));
+    if (!node) {
+      return 0;
+    }
+    batch_.clear();
+    while (node) {
+      timerNode<Element>* next = node->next_;
+      batch_.push_back(std::move(node->element_));
+      release(node);
+      size_--;
+      node = next;
+    }
+    on_expire(now_, batch_);
+    return batch_.size();
+  }
+
+  void* allocate() {
+    if (!free_) {
+      timerNode<Element>* chunk = static_cast<timerNode<Element>*>(
+          ::operator new(kChunk * sizeof(timerNode<Element>)));
+      chunks_.push_back(chunk);
+      for (int i = 0; i < kChunk; ++i) {
+        chunk[i].next_ = free_;
+        free_ = &chunk[i];
+      }
+    }
+    timerNode<Element>* node = free_;
+    free_ = node->next_;
+    return node;
+  }
+
+  void release(timerNode<Element>* node) {
+    node->~timerNode<Element>();
+    node->next_ = free_;
+    free_ = node;
+  }
+
+  // disable copy constructor and assignment operator
+  timingWheel(const timingWheel&);
+  const timingWheel& operator= (const timingWheel&);
+};
+
+
+#endif  // INCLUDE_TIMING_WHEEL_H_
@@ -0,0 +1,121 @@
+#include "timing_wheel.h"
+#include "BinaryHeap_sol.H"
+#include "Timer.H"
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>   // mt19937 etc.
+#include <utility>
+#include <vector>
+
+// A timeout manager with n armed timers, timingWheel against
+// BinaryHeap with lazy cancel (a cancelled timer stays in the heap
+// and is skipped when it reaches the top). Deadlines are up to 2^20
+// ticks ahead; 90% of the timers are cancelled before they fire, in
+// scattered order, then time advances in steps of 1000 ticks until
+// everything has expired.
+// Usage: bench_timing_wheel [n ...]   (default 1M 10M 50M)
+
+typedef std::pair<tick_t, uint32_t> Entry;   // (deadline, timer id)
+
+static const tick_t kHorizon = 1 << 20;
+static const tick_t kStep = 1000;
+
+// timer i is cancelled unless i % 10 == 0; visit them scattered
+static uint32_t scattered(uint64_t i, uint32_t n) {
+  return (i * 2654435761u) % n;
+}
+
+static void report(const char* name, double arm_ms, double cancel_ms,
+                   double drain_ms, uint32_t n, size_t fired) {
+  std::cout << name << "\t" << arm_ms * 1e6 / n << "\t" << cancel_ms * 1e6 / n
+            << "\t\t" << drain_ms << "\t\t" << arm_ms + cancel_ms + drain_ms
+            << "\t" << fired << std::endl;
+}
+
+static size_t runHeap(const std::vector<uint32_t>& delay) {
+  uint32_t n = delay.size();
+  std::vector<bool> armed(n, true);
+  BinaryHeap<Entry> heap;
+  Timer timer;
+  for (uint32_t i = 0; i < n; ++i) {
+    heap.insert(Entry{delay[i], i});
+  }
+  double arm_ms = timer.elapsedMillis();
+
+  timer.reset();
+  for (uint32_t i = 0; i < n; ++i) {
+    uint32_t id = scattered(i, n);
+    if (id % 10 != 0) {
+      armed[id] = false;
+    }
+  }
+  double cancel_ms = timer.elapsedMillis();
+
+  timer.reset();
+  size_t fired = 0;
+  for (tick_t now = 0; !heap.isEmpty(); now += kStep) {
+    while (!heap.isEmpty() && heap.findMin().first <= now) {
+      Entry top;
+      heap.deleteMin(top);
+      if (armed[top.second]) {
+        ++fired;
+      }
+    }
+  }
+  report("BinaryHeap", arm_ms, cancel_ms, timer.elapsedMillis(), n, fired);
+  return fired;
+}
+
+static size_t runWheel(const std::vector<uint32_t>& delay) {
+  uint32_t n = delay.size();
+  std::vector<timingWheel<uint32_t>::handle> handles(n);
+  timingWheel<uint32_t> wheel;
+  Timer timer;
+  for (uint32_t i = 0; i < n; ++i) {
+    handles[i] = wheel.schedule(delay[i], i);
+  }
+  double arm_ms = timer.elapsedMillis();
+
+  timer.reset();
+  for (uint32_t i = 0; i < n; ++i) {
+    uint32_t id = scattered(i, n);
+    if (id % 10 != 0) {
+      wheel.cancel(handles[id]);
+    }
+  }
+  double cancel_ms = timer.elapsedMillis();
+
+  timer.reset();
+  size_t fired = 0;
+  for (tick_t now = 0; !wheel.empty(); now += kStep) {
+    fired += wheel.advance(now, [](tick_t, std::vector<uint32_t>&) {});
+  }
+  report("timingWheel", arm_ms, cancel_ms, timer.elapsedMillis(), n, fired);
+  return fired;
+}
+
+int main(int argc, char** argv) {
+  std::vector<uint32_t> sizes;
+  for (int i = 1; i < argc; ++i) {
+    sizes.push_back(atoi(argv[i]));
+  }
+  if (sizes.empty()) {
+    sizes = {1000000, 10000000, 50000000};
+  }
+
+  std::mt19937 rng(137);
+  for (size_t s = 0; s < sizes.size(); ++s) {
+    std::vector<uint32_t> delay(sizes[s]);
+    for (size_t i = 0; i < delay.size(); ++i) {
+      delay[i] = 1 + rng() % kHorizon;
+    }
+    std::cout << sizes[s] << " timers" << std::endl;
+    std::cout << "manager\t\tns/arm\tns/cancel\tdrain ms\ttotal ms\tfired" << std::endl;
+    if (runHeap(delay) != runWheel(delay)) {
+      std::cout << "Oops! different timers fired" << std::endl;
+    }
+    std::cout << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,183 @@
+#include "timing_wheel.h"
+#include "gtest/gtest.h"
+#include <map>
+#include <random>  // mt19937_64 etc.
+#include <string>
+#include <utility>
+#include <vector>
+
+class timingWheelTest : public testing::Test {
+ protected:
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+
+  // advance w to now, recording every expiry as (tick, element)
+  size_t advanceTo(timingWheel<int>& w, tick_t now) {
+    return w.advance(now, [this](tick_t tick, std::vector<int>& batch) {
+      EXPECT_FALSE(batch.empty());
+      for (size_t i = 0; i < batch.size(); ++i) {
+        fired_.push_back(std::make_pair(tick, batch[i]));
+      }
+    });
+  }
+
+  // setup fixtures
+  timingWheel<int> w0_;
+  std::vector<std::pair<tick_t, int> > fired_;
+};
+
+TEST_F(timingWheelTest, DefaultConstructor) {
+  EXPECT_EQ(0u, w0_.size());
+  EXPECT_TRUE(w0_.empty());
+  EXPECT_EQ(0u, w0_.now());
+  timingWheel<int> w(1000);
+  EXPECT_EQ(1000u, w.now());
+}
+
+TEST_F(timingWheelTest, schedule) {
+  timingWheel<int>::handle h = w0_.schedule(5, 50);
+  EXPECT_EQ(1u, w0_.size());
+  EXPECT_EQ(50, h->element());
+  EXPECT_EQ(5u, h->when());
+  // a tick in the past is due now
+  h = w0_.schedule(0, 0);
+  EXPECT_EQ(0u, h->when());
+  EXPECT_EQ(2u, w0_.size());
+}
+
+TEST_F(timingWheelTest, advance) {
+  w0_.schedule(10, 1);
+  w0_.schedule(3, 2);
+  w0_.schedule(300, 3);
+  w0_.schedule(10, 4);
+  EXPECT_EQ(0u, advanceTo(w0_, 2));
+  EXPECT_EQ(2u, w0_.now());
+  EXPECT_EQ(3u, advanceTo(w0_, 10));
+  ASSERT_EQ(3u, fired_.size());
+  EXPECT_EQ(std::make_pair(tick_t(3), 2), fired_[0]);
+  // same tick: the order they were scheduled in
+  EXPECT_EQ(std::make_pair(tick_t(10), 1), fired_[1]);
+  EXPECT_EQ(std::make_pair(tick_t(10), 4), fired_[2]);
+  EXPECT_EQ(1u, advanceTo(w0_, 1000));
+  EXPECT_EQ(std::make_pair(tick_t(300), 3), fired_[3]);
+  EXPECT_TRUE(w0_.empty());
+  // time does not go back
+  EXPECT_EQ(0u, advanceTo(w0_, 5));
+  EXPECT_EQ(1000u, w0_.now());
+}
+
+TEST_F(timingWheelTest, batch) {
+  for (int i = 0; i < 100; ++i) {
+    w0_.schedule(1 << 20, i);
+  }
+  int calls = 0;
+  w0_.advance(1 << 20, [&calls](tick_t tick, std::vector<int>& batch) {
+    ++calls;
+    EXPECT_EQ(tick_t(1 << 20), tick);
+    ASSERT_EQ(100u, batch.size());
+    for (int i = 0; i < 100; ++i) {
+      EXPECT_EQ(i, batch[i]);
+    }
+  });
+  EXPECT_EQ(1, calls);
+}
+
+TEST_F(timingWheelTest, cancel) {
+  timingWheel<int>::handle a = w0_.schedule(7, 1);
+  timingWheel<int>::handle b = w0_.schedule(70000, 2);
+  w0_.schedule(7, 3);
+  w0_.cancel(a);
+  w0_.cancel(b);
+  EXPECT_EQ(1u, w0_.size());
+  EXPECT_EQ(1u, advanceTo(w0_, 100000));
+  ASSERT_EQ(1u, fired_.size());
+  EXPECT_EQ(3, fired_[0].second);
+}
+
+TEST_F(timingWheelTest, clear) {
+  timingWheel<std::string> w;
+  w.schedule(1, "short");
+  w.schedule(tick_t(1) << 40, "long");
+  w.clear();
+  EXPECT_TRUE(w.empty());
+  size_t expired = w.advance(tick_t(1) << 41,
+      [](tick_t, std::vector<std::string>&) { ADD_FAILURE(); });
+  EXPECT_EQ(0u, expired);
+}
+
+// the last tick is a tick like any other
+TEST_F(timingWheelTest, maxTick) {
+  const tick_t kMax = ~tick_t(0);
+  w0_.schedule(kMax, 1);
+  w0_.schedule(kMax - 1, 2);
+  EXPECT_EQ(1u, advanceTo(w0_, kMax - 1));
+  EXPECT_EQ(1u, advanceTo(w0_, kMax));
+  EXPECT_EQ(0u, advanceTo(w0_, kMax));
+  w0_.schedule(kMax, 3);
+  EXPECT_EQ(1u, advanceTo(w0_, kMax));
+  ASSERT_EQ(3u, fired_.size());
+  EXPECT_EQ(std::make_pair(kMax, 3), fired_[2]);
+}
+
+// callbacks may rearm timers, including for the tick being expired
+TEST_F(timingWheelTest, rearm) {
+  timingWheel<int> w;
+  w.schedule(1, 0);
+  std::vector<tick_t> ticks;
+  w.advance(100, [&](tick_t tick, std::vector<int>& batch) {
+    for (size_t i = 0; i < batch.size(); ++i) {
+      ticks.push_back(tick);
+      if (batch[i] < 5) {
+        w.schedule(tick + (batch[i] % 2 == 0 ? 0 : 40), batch[i] + 1);
+      }
+    }
+  });
+  std::vector<tick_t> expected = {1, 1, 41, 41, 81, 81};
+  EXPECT_EQ(expected, ticks);
+  EXPECT_TRUE(w.empty());
+}
+
+// random schedules, cancels and advances at every scale, from a
+// random start, against a multimap of (tick, sequence number)
+TEST_F(timingWheelTest, random) {
+  std::mt19937_64 rng(131);
+  timingWheel<int> w(rng() >> 1);
+  std::multimap<tick_t, int> expected;
+  std::map<int, std::pair<timingWheel<int>::handle, std::multimap<tick_t, int>::iterator> > live;
+  int seq = 0;
+  for (int round = 0; round < 2000; ++round) {
+    for (int i = 0; i < 50; ++i) {
+      tick_t delta = rng() >> (rng() % 64);
+      tick_t when = w.now() + delta < w.now() ? ~tick_t(0) : w.now() + delta;
+      live[seq] = std::make_pair(w.schedule(when, seq), expected.insert(std::make_pair(when, seq)));
+      ++seq;
+    }
+    for (int i = 0; i < 10 && !live.empty(); ++i) {
+      std::map<int, std::pair<timingWheel<int>::handle,
+          std::multimap<tick_t, int>::iterator> >::iterator it = live.lower_bound(rng() % seq);
+      if (it == live.end()) {
+        continue;
+      }
+      w.cancel(it->second.first);
+      expected.erase(it->second.second);
+      live.erase(it);
+    }
+    tick_t step = rng() >> (24 + rng() % 40);
+    tick_t now = w.now() + step < w.now() ? ~tick_t(0) : w.now() + step;
+    fired_.clear();
+    advanceTo(w, now);
+    std::multimap<tick_t, int>::iterator end = expected.upper_bound(now);
+    ASSERT_EQ(size_t(std::distance(expected.begin(), end)), fired_.size());
+    size_t i = 0;
+    for (std::multimap<tick_t, int>::iterator it = expected.begin(); it != end; ++it, ++i) {
+      EXPECT_EQ(it->first, fired_[i].first);
+      EXPECT_EQ(it->second, fired_[i].second);
+      live.erase(it->second);
+    }
+    expected.erase(expected.begin(), end);
+    ASSERT_EQ(expected.size(), w.size());
+  }
+}
@@ -0,0 +1 @@
+#include "timing_wheel.h"
@@ -0,0 +1,73 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Sort_sol.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Before/after numbers for blockPartition on random scalar keys.
+// Usage: BenchBlockPartition [numItems]
+
+/**
+ * Wraps a scalar so that it is no longer arithmetic; quicksort on
+ * Wrapped<T> therefore uses hoarePartition, the "before" case.
+ */
+template <typename T>
+struct Wrapped
+{
+    T value;
+
+    bool operator<( const Wrapped & rhs ) const
+      { return value < rhs.value; }
+};
+
+template <typename T>
+void run( const char *name, const vector<T> & input )
+{
+    vector<Wrapped<T>> before( input.size( ) );
+    for( size_t i = 0; i < input.size( ); ++i )
+        before[ i ].value = input[ i ];
+    vector<T> after = input;
+    vector<T> stl = input;
+
+    Timer timer;
+    quicksort( before );
+    double hoare = timer.elapsedMillis( );
+
+    timer.reset( );
+    quicksort( after );
+    double block = timer.elapsedMillis( );
+
+    timer.reset( );
+    sort( begin( stl ), end( stl ) );
+    double stdSort = timer.elapsedMillis( );
+
+    if( !is_sorted( begin( after ), end( after ) ) )
+        cout << "Oops! not sorted" << endl;
+    cout << name << "\t" << hoare << "\t\t" << block << "\t\t" << stdSort << endl;
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int numItems = argc > 1 ? atoi( argv[ 1 ] ) : 5000000;
+
+    UniformRandom r{ 5 };
+    vector<int> ints( numItems );
+    vector<double> doubles( numItems );
+    vector<uint64_t> longs( numItems );
+    for( int i = 0; i < numItems; ++i )
+    {
+        ints[ i ] = r.nextInt( );
+        doubles[ i ] = r.nextDouble( );
+        longs[ i ] = static_cast<uint64_t>( r.nextInt( ) ) << 32 | r.nextInt( );
+    }
+
+    cout << numItems << " keys\thoare ms\tblock ms\tstd::sort ms" << endl;
+    run( "int", ints );
+    run( "double", doubles );
+    run( "uint64_t", longs );
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <pthread.h>
+#include "ConcurrentHashSet.H"
+#include "SeparateChaining_sol.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Throughput of one HashTable (separate chaining) behind a single
+// mutex, of HashTables striped over shards behind reader/writer locks,
+// and of ConcurrentHashSet, whose contains takes no lock, at 1, 2, 4,
+// ... maxThreads threads. Keys are random ints below keyRange and
+// the set starts half full. Each thread runs a read-heavy mix (95%
+// contains) and then a write-heavy one (50%); a write inserts its key,
+// or removes it if it was already there.
+// Usage: BenchConcurrentHashSet [opsPerThread] [maxThreads] [keyRange]
+
+    // The single-lock baseline
+class LockedTable
+{
+  public:
+    bool insert( int x )
+    {
+        lock_guard<mutex> lock{ guard };
+        return table.insert( x );
+    }
+
+    bool remove( int x )
+    {
+        lock_guard<mutex> lock{ guard };
+        return table.remove( x );
+    }
+
+    bool contains( int x )
+    {
+        lock_guard<mutex> lock{ guard };
+        return table.contains( x );
+    }
+
+  private:
+    mutex          guard;
+    HashTable<int> table;
+};
+
+    // Plain striping: contains takes a shard's read lock
+class StripedTable
+{
+  public:
+    explicit StripedTable( int shards )
+    {
+        for( int i = 0; i < shards; ++i )
+            theShards.emplace_back( new Shard );
+    }
+
+    bool insert( int x )
+    {
+        Shard & s = shardOf( x );
+        pthread_rwlock_wrlock( &s.guard );
+        bool inserted = s.table.insert( x );
+        pthread_rwlock_unlock( &s.guard );
+        return inserted;
+    }
+
+    bool remove( int x )
+    {
+        Shard & s = shardOf( x );
+        pthread_rwlock_wrlock( &s.guard );
+        bool removed = s.table.remove( x );
+        pthread_rwlock_unlock( &s.guard );
+        return removed;
+    }
+
+    bool contains( int x )
+    {
+        Shard & s = shardOf( x );
+        pthread_rwlock_rdlock( &s.guard );
+        bool found = s.table.contains( x );
+        pthread_rwlock_unlock( &s.guard );
+        return found;
+    }
+
+  private:
+    struct Shard
+    {
+        pthread_rwlock_t guard;
+        HashTable<int>   table;
+        char             pad[ 64 ];
+
+        Shard( )
+          { pthread_rwlock_init( &guard, nullptr ); }
+        ~Shard( )
+          { pthread_rwlock_destroy( &guard ); }
+    };
+
+    vector<unique_ptr<Shard>> theShards;
+
+    Shard & shardOf( int x )
+    {
+        uint64_t m = mixHash( x + 0x9E3779B97F4A7C15ull ) >> 32;
+        return *theShards[ ( m * theShards.size( ) ) >> 32 ];
+    }
+};
+
+    // Millions of operations per second
+template <typename Set>
+double run( Set & s, int numThreads, int opsPerThread, int keyRange, int writePercent )
+{
+    UniformRandom r{ 97 };
+    for( int i = 0; i < keyRange / 2; ++i )
+        s.insert( r.nextInt( keyRange ) );
+
+    vector<vector<int>> keys( numThreads, vector<int>( opsPerThread ) );
+    for( auto & k : keys )
+        for( auto & x : k )
+            x = r.nextInt( keyRange );
+
+    atomic<int> ready{ 0 };
+    atomic<long long> sink{ 0 };
+    vector<thread> threads;
+    Timer timer;
+    for( int t = 0; t < numThreads; ++t )
+        threads.emplace_back( [ &, t ]
+        {
+            ++ready;
+            while( ready.load( ) < numThreads )
+                this_thread::yield( );
+            long long found = 0;
+            for( int i = 0; i < opsPerThread; ++i )
+            {
+                int x = keys[ t ][ i ];
+                if( i % 100 < writePercent )
+                {
+                    if( !s.insert( x ) )
+                        s.remove( x );
+                }
+                else
+                    found += s.contains( x );
+            }
+            sink += found;
+        } );
+    for( auto & th : threads )
+        th.join( );
+    double ms = timer.elapsedMillis( );
+    if( sink.load( ) == 42 )
+        cout << "";
+    return numThreads * double( opsPerThread ) / ms / 1000;
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int opsPerThread = argc > 1 ? atoi( argv[ 1 ] ) : 1000000;
+    int maxThreads = argc > 2 ? atoi( argv[ 2 ] ) : 64;
+    int keyRange = argc > 3 ? atoi( argv[ 3 ] ) : 1000000;
+
+    cout << "hardware threads: " << thread::hardware_concurrency( ) << endl;
+    for( int writePercent : { 5, 50 } )
+    {
+        cout << endl << 100 - writePercent << "/" << writePercent << " contains/writes" << endl;
+        cout << "threads\tlocked\tstriped\tconcurrent\t(Mops/s)" << endl;
+        for( int t = 1; t <= maxThreads; t *= 2 )
+        {
+            LockedTable locked;
+            StripedTable striped{ 4 * t };
+            ConcurrentHashSet<int> concurrent{ 4 * t };
+            cout << t << "\t" << run( locked, t, opsPerThread, keyRange, writePercent )
+                 << "\t" << run( striped, t, opsPerThread, keyRange, writePercent )
+                 << "\t" << run( concurrent, t, opsPerThread, keyRange, writePercent ) << endl;
+        }
+    }
+    return 0;
+}
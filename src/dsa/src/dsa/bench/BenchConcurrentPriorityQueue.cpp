@@ -0,0 +1,161 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "BinaryHeap_sol.H"
+#include "ConcurrentPriorityQueue.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Throughput of one BinaryHeap behind a single mutex versus
+// ConcurrentPriorityQueue in RELAXED and STRICT mode, at 1, 2, 4, ...
+// maxThreads threads. The queue is prefilled, then every thread runs
+// an even mix of insert and deleteMin. Also reports the mean rank
+// error of RELAXED deleteMin (0 for an exact priority queue).
+// Usage: BenchConcurrentPriorityQueue [opsPerThread] [maxThreads] [prefill]
+
+    // The single-lock baseline
+class LockedHeap
+{
+  public:
+    void insert( int x )
+    {
+        lock_guard<mutex> lock{ guard };
+        heap.insert( x );
+    }
+
+    bool tryDeleteMin( int & x )
+    {
+        lock_guard<mutex> lock{ guard };
+        if( heap.isEmpty( ) )
+            return false;
+        heap.deleteMin( x );
+        return true;
+    }
+
+  private:
+    mutex           guard;
+    BinaryHeap<int> heap;
+};
+
+    // Millions of operations per second
+template <typename Queue>
+double run( Queue & q, int numThreads, int opsPerThread, int prefill, long long & checksum )
+{
+    UniformRandom r{ 71 };
+    for( int i = 0; i < prefill; ++i )
+        q.insert( r.nextInt( ) );
+
+    vector<vector<int>> keys( numThreads, vector<int>( opsPerThread ) );
+    for( auto & k : keys )
+        for( auto & x : k )
+            x = r.nextInt( );
+
+    atomic<int> ready{ 0 };
+    atomic<long long> sink{ 0 };
+    vector<thread> threads;
+    Timer timer;
+    for( int t = 0; t < numThreads; ++t )
+        threads.emplace_back( [ &, t ]
+        {
+            ++ready;
+            while( ready.load( ) < numThreads )
+                this_thread::yield( );
+            long long sum = 0;
+            int x;
+            for( int i = 0; i < opsPerThread; ++i )
+                if( i % 2 == 0 )
+                    q.insert( keys[ t ][ i ] );
+                else if( q.tryDeleteMin( x ) )
+                    sum += x;
+            sink += sum;
+        } );
+    for( auto & th : threads )
+        th.join( );
+    double ms = timer.elapsedMillis( );
+    checksum += sink.load( );
+    return numThreads * double( opsPerThread ) / ms / 1000;
+}
+
+    // Fenwick tree over key values, to count the live keys below a key
+class RankCounter
+{
+  public:
+    explicit RankCounter( int n ) : tree( n + 1, 0 ) { }
+
+    void add( int x, int delta )
+    {
+        for( ++x; x < int( tree.size( ) ); x += x & -x )
+            tree[ x ] += delta;
+    }
+
+    int below( int x ) const
+    {
+        int sum = 0;
+        for( ; x > 0; x -= x & -x )
+            sum += tree[ x ];
+        return sum;
+    }
+
+  private:
+    vector<int> tree;
+};
+
+int main( int argc, char *argv[ ] )
+{
+    int opsPerThread = argc > 1 ? atoi( argv[ 1 ] ) : 1000000;
+    int maxThreads = argc > 2 ? atoi( argv[ 2 ] ) : 64;
+    int prefill = argc > 3 ? atoi( argv[ 3 ] ) : 1000000;
+
+    cout << "hardware threads: " << thread::hardware_concurrency( ) << endl;
+    cout << "threads\tlocked heap\trelaxed\tstrict\t(Mops/s)" << endl;
+    for( int t = 1; t <= maxThreads; t *= 2 )
+    {
+        LockedHeap locked;
+        ConcurrentPriorityQueue<int> relaxed{ 4 * t };
+        ConcurrentPriorityQueue<int> strict{ 4 * t, ConcurrentPriorityQueue<int>::STRICT };
+        long long checksum = 0;
+        cout << t << "\t" << run( locked, t, opsPerThread, prefill, checksum );
+        cout << "\t\t" << run( relaxed, t, opsPerThread, prefill, checksum );
+        cout << "\t" << run( strict, t, opsPerThread, prefill, checksum );
+        cout << "\t(" << checksum % 1000 << ")" << endl;
+    }
+
+        // Rank error: how many smaller keys were live when each key left
+    const int KEYS = 1 << 20;
+    cout << endl << "shards\tmean rank error\tmax rank error" << endl;
+    for( int shards : { 4, 16, 64, 256 } )
+    {
+        ConcurrentPriorityQueue<int> q{ shards };
+        RankCounter live{ KEYS };
+        UniformRandom r{ 73 };
+        for( int i = 0; i < KEYS / 2; ++i )
+        {
+            int x = r.nextInt( KEYS );
+            q.insert( x );
+            live.add( x, 1 );
+        }
+        long long total = 0;
+        int worst = 0, pops = 0, x;
+        for( int i = 0; i < KEYS; ++i )
+            if( i % 2 == 0 )
+            {
+                int y = r.nextInt( KEYS );
+                q.insert( y );
+                live.add( y, 1 );
+            }
+            else if( q.tryDeleteMin( x ) )
+            {
+                int rank = live.below( x );
+                total += rank;
+                worst = max( worst, rank );
+                live.add( x, -1 );
+                ++pops;
+            }
+        cout << shards << "\t" << double( total ) / pops << "\t\t" << worst << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,69 @@
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "BinaryHeap_sol.H"
+#include "DaryHeap.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Compares BinaryHeap with DaryHeap for D = 2, 4, 8 on 8-byte keys:
+//   fill:  insert N random keys, then deleteMin them all
+//   hold:  keep N timers queued and do numOps deleteMin + insert
+//          pairs with a later deadline, as a scheduler does
+// Usage: BenchDaryHeap [N] [numOps]
+
+template <typename Heap>
+void run( const char *name, const vector<uint64_t> & keys,
+          const vector<uint64_t> & increments )
+{
+    Heap h;
+    uint64_t x, sum = 0;
+    Timer timer;
+    for( uint64_t k : keys )
+        h.insert( k );
+    double push = timer.elapsedMillis( );
+    timer.reset( );
+    while( !h.isEmpty( ) )
+    {
+        h.deleteMin( x );
+        sum += x;
+    }
+    double pop = timer.elapsedMillis( );
+
+    for( uint64_t k : keys )
+        h.insert( k );
+    timer.reset( );
+    for( size_t i = 0; i < increments.size( ); ++i )
+    {
+        h.deleteMin( x );
+        h.insert( x + increments[ i ] );
+    }
+    double hold = timer.elapsedMillis( );
+
+    cout << name << "\t" << push << "\t\t" << pop << "\t\t" << hold
+         << ( sum == 0 ? "\t(empty)" : "" ) << endl;
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int n = argc > 1 ? atoi( argv[ 1 ] ) : 10000000;
+    int numOps = argc > 2 ? atoi( argv[ 2 ] ) : 10000000;
+
+    UniformRandom r{ 59 };
+    vector<uint64_t> keys( n );
+    for( auto & k : keys )
+        k = static_cast<uint64_t>( r.nextInt( ) ) << 20 | r.nextInt( 1 << 20 );
+    vector<uint64_t> increments( numOps );
+    for( auto & d : increments )
+        d = r.nextInt( 1 << 20 );
+
+    cout << n << " keys, " << numOps << " hold ops" << endl;
+    cout << "heap\t\tinsert ms\tdeleteMin ms\thold ms" << endl;
+    run<BinaryHeap<uint64_t>>( "BinaryHeap", keys, increments );
+    run<DaryHeap<uint64_t, 2>>( "DaryHeap<2>", keys, increments );
+    run<DaryHeap<uint64_t, 4>>( "DaryHeap<4>", keys, increments );
+    run<DaryHeap<uint64_t, 8>>( "DaryHeap<8>", keys, increments );
+    return 0;
+}
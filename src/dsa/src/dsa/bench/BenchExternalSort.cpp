@@ -0,0 +1,85 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "ExternalSort.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Sorts a file of 100-byte records with a small memory budget and
+// reports the run and merge phases and the overall throughput.
+// Usage: BenchExternalSort [numRecords] [memoryMB] [fanIn] [tempDir]
+
+struct Record
+{
+    uint64_t key;
+    char     payload[ 92 ];
+
+    bool operator<( const Record & rhs ) const
+      { return key < rhs.key; }
+};
+
+int main( int argc, char *argv[ ] )
+{
+    int numRecords = argc > 1 ? atoi( argv[ 1 ] ) : 2000000;
+    int memoryMB = argc > 2 ? atoi( argv[ 2 ] ) : 16;
+    int fanIn = argc > 3 ? atoi( argv[ 3 ] ) : 64;
+    string dir = argc > 4 ? argv[ 4 ] : "/tmp";
+    string inName = dir + "/BenchExternalSort.in";
+    string outName = dir + "/BenchExternalSort.out";
+
+    UniformRandom r{ 29 };
+    {
+        ofstream out( inName, ios::binary );
+        Record rec{ };
+        for( int i = 0; i < numRecords; ++i )
+        {
+            rec.key = static_cast<uint64_t>( r.nextInt( ) ) << 32 | r.nextInt( );
+            out.write( reinterpret_cast<const char *>( &rec ), sizeof( rec ) );
+        }
+    }
+
+    ExternalSorter<Record> sorter( static_cast<size_t>( memoryMB ) << 20, dir, fanIn );
+    double nextReport = 0.25;
+    sorter.setProgress( [ & ]( const ExternalSortStats & s )
+    {
+        if( s.fractionDone( ) >= nextReport )
+        {
+            cout << "  " << static_cast<int>( s.fractionDone( ) * 100 ) << "% after "
+                 << s.elapsedSeconds( ) << " s" << endl;
+            nextReport += 0.25;
+        }
+    } );
+    sorter.sort( inName, outName );
+
+    const ExternalSortStats & s = sorter.stats( );
+    double mb = numRecords * sizeof( Record ) / 1e6;
+    cout << numRecords << " records (" << mb << " MB), " << memoryMB << " MB budget, fan-in "
+         << fanIn << endl;
+    cout << "runs\tpasses\trun s\tmerge s\tsort MB/s\tread MB/s\twrite MB/s" << endl;
+    cout << s.runs << "\t" << s.mergePasses << "\t" << s.runSeconds << "\t"
+         << s.mergeSeconds << "\t" << mb / s.elapsedSeconds( ) << "\t\t"
+         << s.readMBPerSecond( ) << "\t\t" << s.writeMBPerSecond( ) << endl;
+
+    ifstream in( outName, ios::binary );
+    Record prev{ }, cur;
+    long long count = 0;
+    while( in.read( reinterpret_cast<char *>( &cur ), sizeof( cur ) ) )
+    {
+        if( count++ > 0 && cur < prev )
+        {
+            cout << "Oops! not sorted" << endl;
+            break;
+        }
+        prev = cur;
+    }
+    if( count != numRecords )
+        cout << "Oops! lost records" << endl;
+
+    remove( inName.c_str( ) );
+    remove( outName.c_str( ) );
+    return 0;
+}
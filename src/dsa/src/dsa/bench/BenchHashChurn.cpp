@@ -0,0 +1,83 @@
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <malloc.h>
+#include <new>
+#include "QuadraticProbing_sol.H"
+#include "Timer.H"
+using namespace std;
+
+// Long-running insert/remove churn on HashTable (quadratic probing):
+// a sliding window of live keys, where every step removes the oldest
+// key and inserts a new one. After each round of window-size steps,
+// reports ns per step, ns per successful and failed lookup (a failed
+// lookup walks the whole probe, DELETED slots included, so its cost
+// tracks the probe length) and heap bytes per live key.
+// Usage: BenchHashChurn [windowSize] [rounds]
+
+static long long liveBytes = 0;
+
+void * operator new( size_t n )
+{
+    void *p = malloc( n ? n : 1 );
+    if( p == nullptr )
+        throw bad_alloc{ };
+    liveBytes += malloc_usable_size( p );
+    return p;
+}
+
+void operator delete( void *p ) noexcept
+{
+    if( p != nullptr )
+        liveBytes -= malloc_usable_size( p );
+    free( p );
+}
+
+void operator delete( void *p, size_t ) noexcept
+  { operator delete( p ); }
+
+    // A bijection on 32 bits, so keys are distinct but scattered
+int key( uint32_t i )
+  { return i * 2654435761u + 12345; }
+
+int main( int argc, char *argv[ ] )
+{
+    int window = argc > 1 ? atoi( argv[ 1 ] ) : 1000000;
+    int rounds = argc > 2 ? atoi( argv[ 2 ] ) : 30;
+    int lookups = window / 4;
+
+    HashTable<int> h;
+    for( int i = 0; i < window; ++i )
+        h.insert( key( i ) );
+
+    cout << "window " << window << ", " << rounds << " rounds" << endl;
+    cout << "round\tns/step\thit ns\tmiss ns\tbytes/key" << endl;
+
+    long long found = 0;
+    uint32_t next = window;
+    for( int round = 1; round <= rounds; ++round )
+    {
+        Timer timer;
+        for( int i = 0; i < window; ++i, ++next )
+        {
+            h.remove( key( next - window ) );
+            h.insert( key( next ) );
+        }
+        double stepNs = timer.elapsedMillis( ) * 1e6 / window;
+
+        timer.reset( );
+        for( int i = 0; i < lookups; ++i )
+            found += h.contains( key( next - 1 - i * 3 ) );
+        double hitNs = timer.elapsedMillis( ) * 1e6 / lookups;
+
+        timer.reset( );
+        for( int i = 0; i < lookups; ++i )
+            found += h.contains( key( next + i ) );
+        double missNs = timer.elapsedMillis( ) * 1e6 / lookups;
+
+        cout << round << "\t" << stepNs << "\t" << hitNs << "\t" << missNs
+             << "\t" << double( liveBytes ) / window << endl;
+    }
+    cout << "(" << found << ")" << endl;
+    return 0;
+}
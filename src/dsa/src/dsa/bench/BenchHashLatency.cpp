@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <string>
+#include <vector>
+#include "QuadraticProbing_sol.H"
+using namespace std;
+
+    // SeparateChaining_sol.H also names its class HashTable; its
+    // standard headers are already in, so only the class lands here
+namespace chaining
+{
+#include "SeparateChaining_sol.H"
+}
+
+// Insert latency of both hash tables, BLOCKING versus INCREMENTAL
+// rehash. Each of n scattered int keys, and then of stringN string
+// keys too long to be stored inline (so each slot has a destructor to
+// run), is inserted into a table growing from the default size, and
+// every insert is timed on its own (the clock read, some 20 ns, is
+// included). Reports the percentiles and maximum of the insert times
+// in ns, and the total in ms.
+// Usage: BenchHashLatency [n] [stringN]
+
+    // A bijection on 32 bits, so keys are distinct but scattered
+int key( uint32_t i )
+  { return i * 2654435761u + 12345; }
+
+string stringKey( uint32_t i )
+  { return "session:" + to_string( uint32_t( key( i ) ) ); }
+
+template <typename Table, typename Key>
+void run( const string & name, typename Table::RehashMode mode, const vector<Key> & keys )
+{
+    int n = keys.size( );
+    vector<uint32_t> ns( n );
+    {
+        Table t{ 101, mode };
+        auto last = chrono::steady_clock::now( );
+        for( int i = 0; i < n; ++i )
+        {
+            t.insert( keys[ i ] );
+            auto now = chrono::steady_clock::now( );
+            ns[ i ] = chrono::duration_cast<chrono::nanoseconds>( now - last ).count( );
+            last = now;
+        }
+    }
+
+    double totalMs = 0;
+    for( auto t : ns )
+        totalMs += t / 1e6;
+
+    cout << name;
+    for( double p : { 0.5, 0.99, 0.999, 0.9999 } )
+    {
+        auto nth = ns.begin( ) + size_t( p * ( n - 1 ) );
+        nth_element( ns.begin( ), nth, ns.end( ) );
+        cout << "\t" << *nth;
+    }
+    cout << "\t" << *max_element( ns.begin( ), ns.end( ) ) << "\t" << totalMs << endl;
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int n = argc > 1 ? atoi( argv[ 1 ] ) : 10000000;
+    int stringN = argc > 2 ? atoi( argv[ 2 ] ) : n / 4;
+
+    typedef HashTable<int> Probing;
+    typedef chaining::HashTable<int> Chaining;
+    typedef HashTable<string> StringProbing;
+    typedef chaining::HashTable<string> StringChaining;
+
+    {
+        vector<int> keys( n );
+        for( int i = 0; i < n; ++i )
+            keys[ i ] = key( i );
+        cout << n << " int inserts" << endl;
+        cout << "table\t\t\tp50\tp99\tp99.9\tp99.99\tmax\ttotal ms" << endl;
+        run<Probing>( "probing blocking\t", Probing::BLOCKING, keys );
+        run<Probing>( "probing incremental\t", Probing::INCREMENTAL, keys );
+        run<Chaining>( "chaining blocking\t", Chaining::BLOCKING, keys );
+        run<Chaining>( "chaining incremental", Chaining::INCREMENTAL, keys );
+    }
+
+    vector<string> keys( stringN );
+    for( int i = 0; i < stringN; ++i )
+        keys[ i ] = stringKey( i );
+    cout << endl << stringN << " string inserts" << endl;
+    cout << "table\t\t\tp50\tp99\tp99.9\tp99.99\tmax\ttotal ms" << endl;
+    run<StringProbing>( "probing blocking\t", StringProbing::BLOCKING, keys );
+    run<StringProbing>( "probing incremental\t", StringProbing::INCREMENTAL, keys );
+    run<StringChaining>( "chaining blocking\t", StringChaining::BLOCKING, keys );
+    run<StringChaining>( "chaining incremental", StringChaining::INCREMENTAL, keys );
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <random>
+#include <string>
+#include <vector>
+#include "QuadraticProbing_sol.H"
+#include "Timer.H"
+using namespace std;
+
+    // SeparateChaining_sol.H also names its class HashTable; its
+    // standard headers are already in, so only the class lands here
+namespace chaining
+{
+#include "SeparateChaining_sol.H"
+}
+
+// Per-operation latency of both hash tables under each sizing policy
+// (see HashSizing.H): PrimeSizing, the textbook prime size and
+// modulo; PowerOfTwoSizing; and FastRangeSizing. Keys are random
+// ints, scattered ints (i times a constant, an arithmetic progression
+// that a prime modulus spreads unusually evenly), sequential ints and
+// strings; table sizes run from one that fits in cache to one that
+// does not. Reports ns per insert (building
+// the table from empty, rehashes included), per successful lookup and
+// per failed lookup.
+// Usage: BenchHashSizing [maxKeys] [lookups]
+
+const int STRIDE = 7919;       // Below the smallest table size
+
+uint32_t scatter( uint32_t i )
+  { return i * 2654435761u + 12345; }
+
+template <typename Table, typename Key>
+void run( const string & name, const vector<Key> & keys,
+          const vector<Key> & misses, int lookups )
+{
+    int n = keys.size( );
+    long long found = 0;
+    Table t;
+
+    Timer timer;
+    for( int i = 0; i < n; ++i )
+        t.insert( keys[ i ] );
+    double insertNs = timer.elapsedMillis( ) * 1e6 / n;
+
+    timer.reset( );
+        // Step through the keys out of order, without a division
+        // that would blur the one being measured
+    for( int i = 0, j = 0; i < lookups; ++i, j = j + STRIDE < n ? j + STRIDE : j + STRIDE - n )
+        found += t.contains( keys[ j ] );
+    double hitNs = timer.elapsedMillis( ) * 1e6 / lookups;
+
+    timer.reset( );
+    for( int i = 0, j = 0; i < lookups; ++i, j = j + STRIDE < n ? j + STRIDE : j + STRIDE - n )
+        found += t.contains( misses[ j ] );
+    double missNs = timer.elapsedMillis( ) * 1e6 / lookups;
+
+    cout << name << "\t" << insertNs << "\t" << hitNs << "\t" << missNs
+         << "\t(" << found << ")" << endl;
+}
+
+template <typename Key>
+void runAll( const string & what, const vector<Key> & keys,
+             const vector<Key> & misses, int lookups )
+{
+    cout << keys.size( ) << " " << what << " keys" << endl;
+    cout << "table\t\t\tinsert\thit\tmiss" << endl;
+    run<HashTable<Key, PrimeSizing>>( "probing prime\t", keys, misses, lookups );
+    run<HashTable<Key, PowerOfTwoSizing>>( "probing power of 2", keys, misses, lookups );
+    run<HashTable<Key, FastRangeSizing>>( "probing fast range", keys, misses, lookups );
+    run<chaining::HashTable<Key, PrimeSizing>>( "chaining prime\t", keys, misses, lookups );
+    run<chaining::HashTable<Key, PowerOfTwoSizing>>( "chaining power of 2", keys, misses, lookups );
+    run<chaining::HashTable<Key, FastRangeSizing>>( "chaining fast range", keys, misses, lookups );
+    cout << endl;
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int maxKeys = argc > 1 ? atoi( argv[ 1 ] ) : 10000000;
+    int lookups = argc > 2 ? atoi( argv[ 2 ] ) : 5000000;
+
+    for( int n = 10000; n <= maxKeys; n *= 10 )
+    {
+        mt19937 rng( n );
+        vector<int> random, randomMisses, keys, misses, sequential, sequentialMisses;
+        for( int i = 0; i < n; ++i )
+        {
+                // Even keys hit, odd keys miss
+            random.push_back( rng( ) & ~1u );
+            randomMisses.push_back( rng( ) | 1 );
+            keys.push_back( scatter( i ) );
+            misses.push_back( scatter( i + n ) );
+            sequential.push_back( i );
+            sequentialMisses.push_back( i + n );
+        }
+        runAll( "random int", random, randomMisses, lookups );
+        runAll( "scattered int", keys, misses, lookups );
+        if( n <= 1000000 )
+            runAll( "sequential int", sequential, sequentialMisses, lookups );
+    }
+
+    vector<string> keys, misses;
+    for( int i = 0; i < 1000000; ++i )
+    {
+        keys.push_back( "session-" + to_string( 1000000000ull + scatter( i ) ) );
+        misses.push_back( "session-" + to_string( 1000000000ull + scatter( i + 1000000 ) ) );
+    }
+    runAll( "string", keys, misses, lookups / 4 );
+    return 0;
+}
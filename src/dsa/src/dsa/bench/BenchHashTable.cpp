@@ -0,0 +1,136 @@
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <malloc.h>
+#include <new>
+#include <string>
+#include <unordered_set>
+#include <vector>
+#include "QuadraticProbing_sol.H"
+#include "SwissHashTable.H"
+#include "Timer.H"
+using namespace std;
+
+// HashTable (quadratic probing, load <= 1/2) versus SwissHashTable
+// (control tags probed 16 at a time, load <= 7/8) and unordered_set,
+// for 1M, 10M, 100M ... int keys and string keys, up to the sizes
+// given. Reports ns per insert, successful lookup, failed lookup and
+// remove, and heap bytes per key once all keys are in.
+// Usage: BenchHashTable [maxIntKeys] [maxStringKeys]
+
+static long long liveBytes = 0;
+
+void * operator new( size_t n )
+{
+    void *p = malloc( n ? n : 1 );
+    if( p == nullptr )
+        throw bad_alloc{ };
+    liveBytes += malloc_usable_size( p );
+    return p;
+}
+
+void operator delete( void *p ) noexcept
+{
+    if( p != nullptr )
+        liveBytes -= malloc_usable_size( p );
+    free( p );
+}
+
+void operator delete( void *p, size_t ) noexcept
+  { operator delete( p ); }
+
+    // A bijection on 32 bits, so keys are distinct but scattered
+uint32_t scatter( uint32_t i )
+  { return i * 2654435761u + 12345; }
+
+int makeInt( uint32_t i )
+  { return scatter( i ); }
+
+string makeString( uint32_t i )
+  { return "session-" + to_string( 1000000000ull + scatter( i ) ); }
+
+template <typename Table, typename Key>
+void run( const string & name, const vector<Key> & keys, const vector<Key> & misses )
+{
+    int n = keys.size( );
+    long long before = liveBytes;
+    Timer timer;
+    double insertNs, hitNs, missNs, removeNs;
+    long long bytes, found = 0;
+    {
+        Table t;
+        for( int i = 0; i < n; ++i )
+            t.insert( keys[ i ] );
+        insertNs = timer.elapsedMillis( ) * 1e6 / n;
+        bytes = liveBytes - before;
+
+            // Look the keys up in a different order than inserted
+        timer.reset( );
+        for( long long i = 0, j = 0; i < n; ++i, j = ( j + 7919 ) % n )
+            found += t.contains( keys[ j ] );
+        hitNs = timer.elapsedMillis( ) * 1e6 / n;
+
+        timer.reset( );
+        for( int i = 0; i < n; ++i )
+            found += t.contains( misses[ i ] );
+        missNs = timer.elapsedMillis( ) * 1e6 / n;
+
+        timer.reset( );
+        for( int i = 0; i < n; i += 2 )
+            found += t.remove( keys[ i ] );
+        removeNs = timer.elapsedMillis( ) * 1e6 / ( n / 2 );
+    }
+
+    cout << name << "\t" << insertNs << "\t" << hitNs << "\t" << missNs
+         << "\t" << removeNs << "\t" << double( bytes ) / n
+         << "\t(" << found << ")" << endl;
+}
+
+    // unordered_set spells remove and contains differently
+template <typename Key>
+class StdSet
+{
+  public:
+    bool insert( const Key & x )
+      { return s.insert( x ).second; }
+    bool remove( const Key & x )
+      { return s.erase( x ) > 0; }
+    bool contains( const Key & x ) const
+      { return s.count( x ) > 0; }
+
+  private:
+    unordered_set<Key> s;
+};
+
+template <typename Key, typename Make>
+void runAll( const string & what, Make make, long long maxKeys )
+{
+    for( long long n = 1000000; n <= maxKeys; n *= 10 )
+    {
+        vector<Key> keys, misses;
+        keys.reserve( n );
+        misses.reserve( n );
+        for( uint32_t i = 0; i < n; ++i )
+        {
+            keys.push_back( make( i ) );
+            misses.push_back( make( i + n ) );
+        }
+
+        cout << n << " " << what << " keys" << endl;
+        cout << "table\t\tinsert\thit\tmiss\tremove\tbytes/key" << endl;
+        run<HashTable<Key>>( "HashTable", keys, misses );
+        run<SwissHashTable<Key>>( "SwissHashTable", keys, misses );
+        run<StdSet<Key>>( "unordered_set", keys, misses );
+        cout << endl;
+    }
+}
+
+int main( int argc, char *argv[ ] )
+{
+    long long maxInts = argc > 1 ? atoll( argv[ 1 ] ) : 10000000;
+    long long maxStrings = argc > 2 ? atoll( argv[ 2 ] ) : 1000000;
+
+    runAll<int>( "int", makeInt, maxInts );
+    runAll<string>( "string", makeString, maxStrings );
+    return 0;
+}
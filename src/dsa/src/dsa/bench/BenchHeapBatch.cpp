@@ -0,0 +1,87 @@
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "BinaryHeap_sol.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Ingests batches into a BinaryHeap of N items with an insert loop and
+// with insertBatch, then takes the k smallest with k deleteMins and
+// with popN. Batches hold random keys, keys that arrive in order, or
+// keys that fall below everything queued (the insert loop's worst case).
+// Usage: BenchHeapBatch [N] [rounds]
+
+enum Keys { RANDOM, ORDERED, FALLING };
+
+void run( int n, int batchSize, int rounds, Keys keys )
+{
+    UniformRandom r{ 73 };
+    vector<uint64_t> base( n );
+    for( auto & x : base )
+        x = static_cast<uint64_t>( r.nextInt( ) ) << 16;
+    vector<vector<uint64_t>> batches( rounds, vector<uint64_t>( batchSize ) );
+    uint64_t clock = static_cast<uint64_t>( 1 ) << 40;
+    uint64_t falling = clock;
+    for( auto & b : batches )
+        for( auto & x : b )
+            if( keys == ORDERED )
+                x = clock++;
+            else if( keys == FALLING )
+                x = --falling;
+            else
+                x = static_cast<uint64_t>( r.nextInt( ) ) << 16;
+
+    BinaryHeap<uint64_t> one{ base }, bulk{ base };
+    vector<uint64_t> out;
+    double insertMs = 0, batchMs = 0, deleteMs = 0, popMs = 0;
+    uint64_t x, sum1 = 0, sum2 = 0;
+    for( auto & b : batches )
+    {
+        Timer timer;
+        for( uint64_t y : b )
+            one.insert( y );
+        insertMs += timer.elapsedMillis( );
+
+        timer.reset( );
+        bulk.insertBatch( b );
+        batchMs += timer.elapsedMillis( );
+
+        timer.reset( );
+        for( int i = 0; i < batchSize; ++i )
+        {
+            one.deleteMin( x );
+            sum1 += x;
+        }
+        deleteMs += timer.elapsedMillis( );
+
+        out.clear( );
+        timer.reset( );
+        bulk.popN( batchSize, out );
+        popMs += timer.elapsedMillis( );
+        for( uint64_t y : out )
+            sum2 += y;
+    }
+    if( sum1 != sum2 )
+        cout << "Oops! heaps disagree" << endl;
+
+    const char *names[ ] = { "random", "ordered", "falling" };
+    cout << n << "\t" << batchSize << "\t" << names[ keys ] << "\t"
+         << insertMs << "\t\t" << batchMs << "\t\t" << deleteMs << "\t\t" << popMs << endl;
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int n = argc > 1 ? atoi( argv[ 1 ] ) : 1000000;
+    int rounds = argc > 2 ? atoi( argv[ 2 ] ) : 20;
+
+    cout << rounds << " rounds of insert + pop of a batch" << endl;
+    cout << "heap\tbatch\tkeys\tinsert ms\tinsertBatch ms\tdeleteMin ms\tpopN ms" << endl;
+    for( int batchSize : { 1000, 10000, 100000 } )
+        for( Keys keys : { RANDOM, ORDERED, FALLING } )
+            run( n, batchSize, rounds, keys );
+    for( Keys keys : { RANDOM, FALLING } )
+        run( n / 100, 100000, rounds, keys );
+    return 0;
+}
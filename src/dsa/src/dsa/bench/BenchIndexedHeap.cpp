@@ -0,0 +1,187 @@
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <utility>
+#include <vector>
+#include "BinaryHeap_sol.H"
+#include "IndexedBinaryHeap.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Dijkstra and timer rescheduling with a BinaryHeap that holds stale
+// duplicates (skipped lazily) versus IndexedBinaryHeap with
+// decreaseKey / increaseKey. Reports time and peak heap entries.
+// Usage: BenchIndexedHeap [numVertices] [degree] [numTimers]
+
+typedef pair<int64_t, int> Entry;      // (distance or deadline, id)
+
+struct Graph
+{
+    vector<int> first;                  // CSR offsets
+    vector<int> to;
+    vector<int> weight;
+};
+
+int main( int argc, char *argv[ ] )
+{
+    int n = argc > 1 ? atoi( argv[ 1 ] ) : 1000000;
+    int degree = argc > 2 ? atoi( argv[ 2 ] ) : 8;
+    int numTimers = argc > 3 ? atoi( argv[ 3 ] ) : 1000000;
+    const int64_t INF = numeric_limits<int64_t>::max( );
+
+    UniformRandom r{ 67 };
+    Graph g;
+    for( int v = 0; v < n; ++v )
+    {
+        g.first.push_back( g.to.size( ) );
+        for( int e = 0; e < degree; ++e )
+        {
+            g.to.push_back( r.nextInt( n ) );
+            g.weight.push_back( r.nextInt( 1, 1000 ) );
+        }
+    }
+    g.first.push_back( g.to.size( ) );
+
+    cout << "Dijkstra, " << n << " vertices, " << n * degree << " edges" << endl;
+    cout << "heap\t\tms\tpeak entries" << endl;
+
+    vector<int64_t> lazyDist( n, INF );
+    {
+        BinaryHeap<Entry> h;
+        long long live = 0, peak = 0;
+        Timer timer;
+        lazyDist[ 0 ] = 0;
+        h.insert( Entry{ 0, 0 } );
+        live = 1;
+        Entry top;
+        while( !h.isEmpty( ) )
+        {
+            h.deleteMin( top );
+            --live;
+            int v = top.second;
+            if( top.first != lazyDist[ v ] )
+                continue;                   // stale duplicate
+            for( int e = g.first[ v ]; e < g.first[ v + 1 ]; ++e )
+            {
+                int64_t d = top.first + g.weight[ e ];
+                if( d < lazyDist[ g.to[ e ] ] )
+                {
+                    lazyDist[ g.to[ e ] ] = d;
+                    h.insert( Entry{ d, g.to[ e ] } );
+                    peak = max( peak, ++live );
+                }
+            }
+        }
+        cout << "lazy BinaryHeap\t" << timer.elapsedMillis( ) << "\t" << peak << endl;
+    }
+
+    {
+        vector<int64_t> dist( n, INF );
+        vector<int> handle( n, -1 );
+        IndexedBinaryHeap<Entry> h;
+        long long peak = 0;
+        Timer timer;
+        dist[ 0 ] = 0;
+        handle[ 0 ] = h.insert( Entry{ 0, 0 } );
+        Entry top;
+        while( !h.isEmpty( ) )
+        {
+            h.deleteMin( top );
+            int v = top.second;
+            for( int e = g.first[ v ]; e < g.first[ v + 1 ]; ++e )
+            {
+                int w = g.to[ e ];
+                int64_t d = top.first + g.weight[ e ];
+                if( d < dist[ w ] )
+                {
+                    if( dist[ w ] == INF )
+                        handle[ w ] = h.insert( Entry{ d, w } );
+                    else
+                        h.decreaseKey( handle[ w ], Entry{ d, w } );
+                    dist[ w ] = d;
+                    peak = max<long long>( peak, h.size( ) );
+                }
+            }
+        }
+        cout << "IndexedBinaryHeap\t" << timer.elapsedMillis( ) << "\t" << peak << endl;
+        if( dist != lazyDist )
+            cout << "Oops! distances differ" << endl;
+    }
+
+        // Each step fires the earliest timer and reschedules two others
+    cout << endl << "Timers, " << numTimers << " live, " << 2 * numTimers << " reschedules" << endl;
+    cout << "heap\t\tms\tpeak entries" << endl;
+    vector<int64_t> when( numTimers );
+    for( auto & t : when )
+        t = r.nextInt( 1000000 );
+    vector<int> picks( 3 * numTimers );
+    for( auto & p : picks )
+        p = r.nextInt( numTimers );
+    vector<int> shifts( 3 * numTimers );
+    for( auto & s : shifts )
+        s = r.nextInt( -50000, 100000 );
+    int64_t lazyChecksum = 0, indexedChecksum = 0;
+
+    {
+        vector<int64_t> deadline = when;
+        BinaryHeap<Entry> h;
+        long long live = 0, peak = 0;
+        for( int i = 0; i < numTimers; ++i, ++live )
+            h.insert( Entry{ deadline[ i ], i } );
+        Timer timer;
+        Entry top;
+        for( int step = 0; step < numTimers; ++step )
+        {
+            for( int k = 0; k < 2; ++k )
+            {
+                int id = picks[ 3 * step + k ];
+                deadline[ id ] += shifts[ 3 * step + k ];
+                h.insert( Entry{ deadline[ id ], id } );
+                peak = max( peak, ++live );
+            }
+            do
+            {
+                h.deleteMin( top );
+                --live;
+            } while( top.first != deadline[ top.second ] );
+            lazyChecksum += top.first;
+            deadline[ top.second ] += 1000000;
+            h.insert( Entry{ deadline[ top.second ], top.second } );
+            ++live;
+        }
+        cout << "lazy BinaryHeap\t" << timer.elapsedMillis( ) << "\t" << peak << endl;
+    }
+
+    {
+        vector<int64_t> deadline = when;
+        vector<int> handle( numTimers );
+        IndexedBinaryHeap<Entry> h;
+        for( int i = 0; i < numTimers; ++i )
+            handle[ i ] = h.insert( Entry{ deadline[ i ], i } );
+        Timer timer;
+        Entry top;
+        for( int step = 0; step < numTimers; ++step )
+        {
+            for( int k = 0; k < 2; ++k )
+            {
+                int id = picks[ 3 * step + k ];
+                int shift = shifts[ 3 * step + k ];
+                deadline[ id ] += shift;
+                if( shift < 0 )
+                    h.decreaseKey( handle[ id ], Entry{ deadline[ id ], id } );
+                else
+                    h.increaseKey( handle[ id ], Entry{ deadline[ id ], id } );
+            }
+            int id = h.findMin( ).second;
+            indexedChecksum += h.findMin( ).first;
+            deadline[ id ] += 1000000;
+            h.increaseKey( handle[ id ], Entry{ deadline[ id ], id } );
+        }
+        cout << "IndexedBinaryHeap\t" << timer.elapsedMillis( ) << "\t" << h.size( ) << endl;
+    }
+    if( lazyChecksum != indexedChecksum )
+        cout << "Oops! timers fired differently" << endl;
+    return 0;
+}
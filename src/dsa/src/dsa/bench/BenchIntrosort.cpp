@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Sort_sol.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Compares quicksort and introsort on random input and on a
+// median-of-3 killer built against quicksort itself.
+// Usage: BenchIntrosort [numItems]
+
+/**
+ * McIlroy's adversary ("A Killer Adversary for Quicksort").
+ * Every item starts as "gas" (larger than anything solid); whenever
+ * two gas items are compared one of them is frozen to the next solid
+ * value, so the pivot always ends up being a bad one. Running the
+ * sort once over Adversary items records an input that drives that
+ * very sort quadratic.
+ */
+class Adversary
+{
+  public:
+    int index;
+
+    bool operator<( const Adversary & rhs ) const
+      { return compare( index, rhs.index ) < 0; }
+
+    static vector<int> & values( )
+    {
+        static vector<int> val;
+        return val;
+    }
+
+    static void reset( int n )
+    {
+        values( ).assign( n, n );  // n is gas
+        nsolid( ) = 0;
+        candidate( ) = 0;
+    }
+
+  private:
+    static int & nsolid( )
+    {
+        static int n = 0;
+        return n;
+    }
+
+    static int & candidate( )
+    {
+        static int c = 0;
+        return c;
+    }
+
+    static int compare( int x, int y )
+    {
+        vector<int> & val = values( );
+        int gas = val.size( );
+
+        if( val[ x ] == gas && val[ y ] == gas )
+            val[ x == candidate( ) ? x : y ] = nsolid( )++;
+        if( val[ x ] == gas )
+            candidate( ) = x;
+        else if( val[ y ] == gas )
+            candidate( ) = y;
+        return val[ x ] - val[ y ];
+    }
+};
+
+vector<int> medianOf3Killer( int n )
+{
+    vector<Adversary> items( n );
+    for( int i = 0; i < n; ++i )
+        items[ i ].index = i;
+
+    Adversary::reset( n );
+    quicksort( items );
+
+    vector<int> input = Adversary::values( );
+    int next = n;
+    for( auto & x : input )           // freeze whatever is still gas
+        if( x == n )
+            x = next++;
+    return input;
+}
+
+template <typename Sorter>
+double timeSort( const vector<int> & input, Sorter sorter )
+{
+    vector<int> a = input;
+    Timer timer;
+    sorter( a );
+    double elapsed = timer.elapsedMillis( );
+
+    if( !is_sorted( begin( a ), end( a ) ) )
+        cout << "Oops! not sorted" << endl;
+    return elapsed;
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int numItems = argc > 1 ? atoi( argv[ 1 ] ) : 50000;
+
+    UniformRandom r{ 11 };
+    vector<int> random( numItems );
+    for( auto & x : random )
+        x = r.nextInt( );
+
+    vector<int> killer = medianOf3Killer( numItems );
+
+    auto qs = []( vector<int> & a ) { quicksort( a ); };
+    auto is = []( vector<int> & a ) { introsort( a ); };
+
+    cout << numItems << " ints\tquicksort ms\tintrosort ms" << endl;
+    cout << "random\t\t" << timeSort( random, qs ) << "\t\t" << timeSort( random, is ) << endl;
+    cout << "m3 killer\t" << timeSort( killer, qs ) << "\t\t" << timeSort( killer, is ) << endl;
+    return 0;
+}
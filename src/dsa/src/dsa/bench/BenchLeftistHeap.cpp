@@ -0,0 +1,82 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "LeftistHeap.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Stress for LeftistHeap on degenerate insertion orders. Descending
+// keys chain every node down the left side; ascending keys and a
+// zigzag make long merges. For each order: insert, copy, merge with
+// a second heap, a run of deleteMins, and makeEmpty.
+// Usage: BenchLeftistHeap [numItems] [numDeletes]
+// (100M items with NodePool need about 6.5GB for heap and copy)
+
+template <typename Heap>
+void run( const string & order, const vector<int> & keys, int numDeletes )
+{
+    Heap h;
+    Timer timer;
+    for( int k : keys )
+        h.insert( k );
+    double insertMs = timer.elapsedMillis( );
+
+    timer.reset( );
+    Heap copy = h;
+    double copyMs = timer.elapsedMillis( );
+
+    timer.reset( );
+    h.merge( copy );
+    double mergeMs = timer.elapsedMillis( );
+
+    timer.reset( );
+    long long checksum = 0;
+    int x;
+    for( int i = 0; i < numDeletes && !h.isEmpty( ); ++i )
+    {
+        h.deleteMin( x );
+        checksum += x;
+    }
+    double deleteMs = timer.elapsedMillis( );
+
+    timer.reset( );
+    h.makeEmpty( );
+    double emptyMs = timer.elapsedMillis( );
+
+    cout << order << "\t" << insertMs << "\t" << copyMs << "\t" << mergeMs
+         << "\t" << deleteMs << "\t" << emptyMs << "\t(" << checksum % 1000 << ")" << endl;
+}
+
+template <typename Heap>
+void runAll( const string & name, int n, int numDeletes )
+{
+    cout << name << ", " << n << " items" << endl;
+    cout << "order\t\tinsert ms\tcopy ms\tmerge ms\tdeleteMin ms\tmakeEmpty ms" << endl;
+    vector<int> keys( n );
+    for( int i = 0; i < n; ++i )
+        keys[ i ] = n - i;
+    run<Heap>( "descending", keys, numDeletes );
+    for( int i = 0; i < n; ++i )
+        keys[ i ] = i;
+    run<Heap>( "ascending", keys, numDeletes );
+    for( int i = 0; i < n; ++i )
+        keys[ i ] = i % 2 == 0 ? i : n - i;
+    run<Heap>( "zigzag\t", keys, numDeletes );
+    UniformRandom r{ 97 };
+    for( auto & k : keys )
+        k = r.nextInt( );
+    run<Heap>( "random\t", keys, numDeletes );
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int n = argc > 1 ? atoi( argv[ 1 ] ) : 10000000;
+    int numDeletes = argc > 2 ? atoi( argv[ 2 ] ) : 1000000;
+
+    runAll<LeftistHeap<int>>( "LeftistHeap", n, numDeletes );
+    cout << endl;
+    runAll<LeftistHeap<int, NodePool>>( "LeftistHeap, NodePool", n, numDeletes );
+    return 0;
+}
@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Sort_sol.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Times p50/p90/p99/p999 of latency-like samples: four quickSelects,
+// one full sort, and multiSelect with each pivot rule, serial and
+// on pools of 1..maxThreads threads.
+// Usage: BenchMultiSelect [numItems] [maxThreads]
+
+int main( int argc, char *argv[ ] )
+{
+    int numItems = argc > 1 ? atoi( argv[ 1 ] ) : 20000000;
+    int maxThreads = argc > 2 ? atoi( argv[ 2 ] ) : WorkStealingPool::defaultThreads( );
+
+    UniformRandom r{ 43 };
+    vector<double> input( numItems );
+    for( auto & x : input )             // log-normal, like request latencies
+    {
+        double u = r.nextDouble( ) + 1e-12, v = r.nextDouble( );
+        x = exp( 1.0 + 0.8 * sqrt( -2 * log( u ) ) * cos( 6.283185307 * v ) );
+    }
+    vector<int> ranks{ numItems / 2, numItems / 10 * 9, numItems / 100 * 99, numItems / 1000 * 999 };
+
+    cout << numItems << " samples, ranks p50/p90/p99/p999" << endl;
+    cout << "method\t\t\tms" << endl;
+
+    vector<double> a = input;
+    Timer timer;
+    for( int k : ranks )
+        quickSelect( a, k );
+    cout << "4 x quickSelect\t\t" << timer.elapsedMillis( ) << endl;
+
+    a = input;
+    timer.reset( );
+    sort( begin( a ), end( a ) );
+    cout << "std::sort\t\t" << timer.elapsedMillis( ) << endl;
+    vector<double> expected = a;
+
+    a = input;
+    timer.reset( );
+    multiSelect( a, ranks );
+    cout << "multiSelect median3\t" << timer.elapsedMillis( ) << endl;
+
+    a = input;
+    timer.reset( );
+    multiSelect( a, ranks, PivotRule::FLOYD_RIVEST );
+    cout << "multiSelect FR\t\t" << timer.elapsedMillis( ) << endl;
+    for( int k : ranks )
+        if( a[ k - 1 ] != expected[ k - 1 ] )
+            cout << "Oops! wrong rank " << k << endl;
+
+    for( int t = 1; t <= maxThreads; t *= 2 )
+    {
+        WorkStealingPool pool{ t };
+        for( PivotRule rule : { PivotRule::MEDIAN_OF_THREE, PivotRule::FLOYD_RIVEST } )
+        {
+            a = input;
+            timer.reset( );
+            parallelMultiSelect( a, ranks, pool, rule );
+            cout << "parallel " << ( rule == PivotRule::FLOYD_RIVEST ? "FR" : "median3" )
+                 << " " << t << "T\t" << timer.elapsedMillis( ) << endl;
+            for( int k : ranks )
+                if( a[ k - 1 ] != expected[ k - 1 ] )
+                    cout << "Oops! wrong rank " << k << endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+#include "BinomialQueue_sol.H"
+#include "LeftistHeap.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// LeftistHeap and BinomialQueue with NewDeleteNodes versus NodePool:
+// calls to operator new and time for building a heap, a hold phase
+// (deleteMin then insert a later key), a copy, and makeEmpty.
+// Each heap runs twice and only the second run is shown, so neither
+// allocator is charged for first touching its memory.
+// Usage: BenchNodePool [numItems] [holdOps]
+
+static long long newCalls = 0;
+
+void * operator new( size_t n )
+{
+    ++newCalls;
+    void *p = malloc( n ? n : 1 );
+    if( p == nullptr )
+        throw bad_alloc{ };
+    return p;
+}
+
+void operator delete( void *p ) noexcept
+  { free( p ); }
+
+void operator delete( void *p, size_t ) noexcept
+  { free( p ); }
+
+template <typename Heap>
+void runOnce( const string & name, const vector<int> & keys,
+              const vector<int> & increments, bool show )
+{
+    Heap h;
+    long long checksum = 0;
+
+    long long calls = newCalls;
+    Timer timer;
+    for( int k : keys )
+        h.insert( k );
+    double buildMs = timer.elapsedMillis( );
+    long long buildCalls = newCalls - calls;
+
+    calls = newCalls;
+    timer.reset( );
+    int x;
+    for( int inc : increments )
+    {
+        h.deleteMin( x );
+        checksum += x;
+        h.insert( x + inc );
+    }
+    double holdMs = timer.elapsedMillis( );
+    long long holdCalls = newCalls - calls;
+
+    calls = newCalls;
+    timer.reset( );
+    Heap copy = h;
+    double copyMs = timer.elapsedMillis( );
+    long long copyCalls = newCalls - calls;
+
+    timer.reset( );
+    copy.makeEmpty( );
+    double emptyMs = timer.elapsedMillis( );
+
+    if( show )
+        cout << name << "\t" << buildMs << "\t" << buildCalls
+             << "\t" << holdMs << "\t" << holdCalls
+             << "\t" << copyMs << "\t" << copyCalls
+             << "\t" << emptyMs << "\t(" << checksum % 1000 << ")" << endl;
+}
+
+template <typename Heap>
+void run( const string & name, const vector<int> & keys, const vector<int> & increments )
+{
+    runOnce<Heap>( name, keys, increments, false );
+    runOnce<Heap>( name, keys, increments, true );
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int n = argc > 1 ? atoi( argv[ 1 ] ) : 1000000;
+    int holdOps = argc > 2 ? atoi( argv[ 2 ] ) : 4000000;
+
+    UniformRandom r{ 89 };
+    vector<int> keys( n );
+    for( auto & k : keys )
+        k = r.nextInt( 1 << 30 );
+    vector<int> increments( holdOps );
+    for( auto & inc : increments )
+        inc = r.nextInt( 1 << 20 );
+
+    cout << n << " items, " << holdOps << " hold operations" << endl;
+    cout << "heap\t\t\tbuild ms\tnews\thold ms\tnews\tcopy ms\tnews\tmakeEmpty ms" << endl;
+    run<LeftistHeap<int>>( "LeftistHeap new/delete", keys, increments );
+    run<LeftistHeap<int, NodePool>>( "LeftistHeap NodePool", keys, increments );
+    run<BinomialQueue<int>>( "BinomialQueue new/delete", keys, increments );
+    run<BinomialQueue<int, NodePool>>( "BinomialQueue NodePool", keys, increments );
+    return 0;
+}
@@ -0,0 +1,114 @@
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BinomialQueue_sol.H"
+#include "LeftistHeap.H"
+#include "PairingHeap.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// PairingHeap against LeftistHeap and BinomialQueue, each with
+// new/delete and with NodePool: n random inserts; an insert-heavy
+// mix (three inserts per deleteMin); draining the heap; and melding
+// n / 8 heaps of 8 items into one. Then PairingHeap alone on a
+// decreaseKey-heavy load.
+// Usage: BenchPairingHeap [numItems]
+
+template <typename Heap>
+void run( const string & name, const vector<int> & keys )
+{
+    int n = keys.size( );
+    long long checksum = 0;
+    int x;
+    Heap h;
+
+    Timer timer;
+    for( int k : keys )
+        h.insert( k );
+    double insertMs = timer.elapsedMillis( );
+
+    timer.reset( );
+    for( int i = 0; i < n; ++i )
+        if( i % 4 == 3 )
+        {
+            h.deleteMin( x );
+            checksum += x;
+        }
+        else
+            h.insert( keys[ i ] ^ 0x5555 );
+    double mixMs = timer.elapsedMillis( );
+
+    timer.reset( );
+    while( !h.isEmpty( ) )
+    {
+        h.deleteMin( x );
+        checksum += x;
+    }
+    double drainMs = timer.elapsedMillis( );
+
+    vector<Heap> small( n / 8 );
+    for( int i = 0; i < n / 8 * 8; ++i )
+        small[ i / 8 ].insert( keys[ i ] );
+    timer.reset( );
+    for( auto & s : small )
+        h.merge( s );
+    double meldMs = timer.elapsedMillis( );
+    h.deleteMin( x );
+    checksum += x;
+
+    cout << name << "\t" << insertMs << "\t" << mixMs << "\t" << drainMs
+         << "\t" << meldMs << "\t(" << checksum % 1000 << ")" << endl;
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int n = argc > 1 ? atoi( argv[ 1 ] ) : 2000000;
+
+    UniformRandom r{ 101 };
+    vector<int> keys( n );
+    for( auto & k : keys )
+        k = r.nextInt( 1 << 30 );
+
+    cout << n << " items" << endl;
+    cout << "heap\t\t\tinsert ms\tmix ms\tdrain ms\tmeld ms" << endl;
+    run<LeftistHeap<int>>( "LeftistHeap\t", keys );
+    run<BinomialQueue<int>>( "BinomialQueue\t", keys );
+    run<PairingHeap<int>>( "PairingHeap\t", keys );
+    run<LeftistHeap<int, NodePool>>( "LeftistHeap pool", keys );
+    run<BinomialQueue<int, NodePool>>( "BinomialQueue pool", keys );
+    run<PairingHeap<int, NodePool>>( "PairingHeap pool", keys );
+
+        // Keys only go down, as in Dijkstra: insert n, then up to n
+        // decreaseKeys of random live items between deleteMins
+    typedef pair<int, int> Entry;      // ( key, id )
+    PairingHeap<Entry, NodePool> h;
+    vector<PairingHeap<Entry, NodePool>::Position> pos( n );
+    vector<int> value( keys );
+    vector<bool> live( n, true );
+    for( int i = 0; i < n; ++i )
+        pos[ i ] = h.insert( Entry{ value[ i ], i } );
+    Timer timer;
+    long long decreases = 0;
+    Entry top;
+    for( int i = 0; i < n; ++i )
+    {
+        int id = keys[ ( i * 7LL ) % n ] % n;
+        if( live[ id ] && value[ id ] > 0 )
+        {
+            value[ id ] -= value[ id ] / 2 + 1;
+            h.decreaseKey( pos[ id ], Entry{ value[ id ], id } );
+            ++decreases;
+        }
+        if( i % 4 == 3 )
+        {
+            h.deleteMin( top );
+            live[ top.second ] = false;
+        }
+    }
+    cout << endl << "PairingHeap pool, " << decreases << " decreaseKeys with "
+         << n / 4 << " deleteMins: " << timer.elapsedMillis( ) << " ms" << endl;
+    return 0;
+}
@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Sort_sol.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Compares the top-down mergeSort with bottomUpMergeSort and
+// parallelMergeSort; every variant sorts the same input several
+// times, the bottom-up ones reusing one scratch buffer.
+// Usage: BenchParallelMergeSort [numItems] [maxThreads] [repeats]
+
+int main( int argc, char *argv[ ] )
+{
+    int numItems = argc > 1 ? atoi( argv[ 1 ] ) : 4000000;
+    int maxThreads = argc > 2 ? atoi( argv[ 2 ] ) : WorkStealingPool::defaultThreads( );
+    int repeats = argc > 3 ? atoi( argv[ 3 ] ) : 3;
+
+    UniformRandom r{ 13 };
+    vector<int> input( numItems );
+    for( auto & x : input )
+        x = r.nextInt( );
+
+    vector<int> a;
+    double elapsed = 0;
+    for( int k = 0; k < repeats; ++k )
+    {
+        a = input;
+        Timer timer;
+        mergeSort( a );
+        elapsed += timer.elapsedMillis( );
+    }
+    double topDown = elapsed / repeats;
+    cout << "mergeSort (top-down), " << numItems << " ints: " << topDown << " ms" << endl;
+
+    vector<int> scratch;
+    elapsed = 0;
+    for( int k = 0; k < repeats; ++k )
+    {
+        a = input;
+        Timer timer;
+        bottomUpMergeSort( a, scratch );
+        elapsed += timer.elapsedMillis( );
+    }
+    cout << "bottomUpMergeSort: " << elapsed / repeats << " ms" << endl;
+
+    cout << "threads\tms\tspeedup vs top-down" << endl;
+    for( int numThreads = 1; numThreads <= maxThreads; numThreads *= 2 )
+    {
+        WorkStealingPool pool{ numThreads };
+
+        elapsed = 0;
+        for( int k = 0; k < repeats; ++k )
+        {
+            a = input;
+            Timer timer;
+            parallelMergeSort( a, scratch, pool );
+            elapsed += timer.elapsedMillis( );
+        }
+        if( !is_sorted( begin( a ), end( a ) ) )
+            cout << "Oops! not sorted" << endl;
+        elapsed /= repeats;
+        cout << numThreads << "\t" << elapsed << "\t" << topDown / elapsed << endl;
+
+        if( numThreads < maxThreads && numThreads * 2 > maxThreads )
+            numThreads = maxThreads / 2;   // always finish on maxThreads
+    }
+    return 0;
+}
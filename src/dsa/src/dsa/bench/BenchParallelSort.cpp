@@ -0,0 +1,47 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "Sort_sol.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Scaling benchmark for parallelQuicksort.
+// Usage: BenchParallelSort [numItems] [maxThreads]
+
+int main( int argc, char *argv[ ] )
+{
+    int numItems = argc > 1 ? atoi( argv[ 1 ] ) : 4000000;
+    int maxThreads = argc > 2 ? atoi( argv[ 2 ] ) : WorkStealingPool::defaultThreads( );
+
+    UniformRandom r{ 7 };
+    vector<int> input( numItems );
+    for( auto & x : input )
+        x = r.nextInt( );
+
+    vector<int> a = input;
+    Timer timer;
+    quicksort( a );
+    double serial = timer.elapsedMillis( );
+    cout << "quicksort, " << numItems << " ints: " << serial << " ms" << endl;
+
+    cout << "threads\tms\tspeedup" << endl;
+    for( int numThreads = 1; numThreads <= maxThreads; numThreads *= 2 )
+    {
+        WorkStealingPool pool{ numThreads };
+
+        a = input;
+        timer.reset( );
+        parallelQuicksort( a, pool );
+        double elapsed = timer.elapsedMillis( );
+
+        if( !is_sorted( begin( a ), end( a ) ) )
+            cout << "Oops! not sorted" << endl;
+        cout << numThreads << "\t" << elapsed << "\t" << serial / elapsed << endl;
+
+        if( numThreads < maxThreads && numThreads * 2 > maxThreads )
+            numThreads = maxThreads / 2;   // always finish on maxThreads
+    }
+    return 0;
+}
@@ -0,0 +1,68 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "RadixSort.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// prefixRadixSort against the book's three string radix sorts
+// (radixSortA, countingRadixSort, radixSort) on fixed-length keys,
+// where all three apply, and against radixSort on variable lengths.
+// Usage: BenchPrefixRadixSort [numItems]
+
+static UniformRandom r{ 29 };
+
+vector<string> fixedKeys( int n, int len )
+{
+    vector<string> keys( n );
+    for( auto & s : keys )
+        for( int j = 0; j < len; ++j )
+            s += static_cast<char>( 'a' + r.nextInt( 26 ) );
+    return keys;
+}
+
+template <typename Sorter>
+void run( const char *name, const vector<string> & input, Sorter sorter )
+{
+    double megabytes = 0;
+    for( auto & s : input )
+        megabytes += s.size( ) / 1e6;
+
+    vector<string> a = input;
+    Timer timer;
+    sorter( a );
+    double elapsed = timer.elapsedMillis( );
+
+    if( !is_sorted( begin( a ), end( a ) ) )
+        cout << "Oops! not sorted" << endl;
+    cout << "  " << name << "\t" << elapsed << " ms\t" << megabytes / elapsed * 1000 << " MB/s" << endl;
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int numItems = argc > 1 ? atoi( argv[ 1 ] ) : 200000;
+
+    for( int len : { 16, 64, 256 } )
+    {
+        vector<string> keys = fixedKeys( numItems, len );
+        cout << numItems << " keys of length " << len << endl;
+        run( "radixSortA\t", keys, [ len ]( vector<string> & a ) { radixSortA( a, len ); } );
+        run( "countingRadixSort", keys, [ len ]( vector<string> & a ) { countingRadixSort( a, len ); } );
+        run( "radixSort\t", keys, [ len ]( vector<string> & a ) { radixSort( a, len ); } );
+        run( "prefixRadixSort\t", keys, []( vector<string> & a ) { prefixRadixSort( a ); } );
+    }
+
+        // Variable lengths, 8 to 1000; with a long common prefix
+    vector<string> keys( numItems );
+    string common( 40, 'p' );
+    for( auto & s : keys )
+        s = common + fixedKeys( 1, r.nextInt( 8, 960 ) )[ 0 ];
+    cout << numItems << " keys of length 48 to 1000, 40-byte common prefix" << endl;
+    run( "radixSort\t", keys, []( vector<string> & a ) { radixSort( a, 1000 ); } );
+    run( "msdRadixSort\t", keys, []( vector<string> & a ) { msdRadixSort( a ); } );
+    run( "prefixRadixSort\t", keys, []( vector<string> & a ) { prefixRadixSort( a ); } );
+    return 0;
+}
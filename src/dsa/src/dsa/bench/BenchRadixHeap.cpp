@@ -0,0 +1,93 @@
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+#include "BinaryHeap_sol.H"
+#include "DaryHeap.H"
+#include "RadixHeap.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Dijkstra on a random graph with BinaryHeap, DaryHeap<4> and
+// RadixHeap, each holding stale duplicates that are skipped lazily.
+// Run for small and large edge weights.
+// Usage: BenchRadixHeap [numVertices] [degree]
+
+typedef pair<uint64_t, int> Entry;     // ( distance, vertex )
+
+struct Graph
+{
+    vector<int> first;                  // CSR offsets
+    vector<int> to;
+    vector<int> weight;
+};
+
+template <typename Heap>
+vector<uint64_t> dijkstra( const Graph & g, const string & name )
+{
+    int n = g.first.size( ) - 1;
+    vector<uint64_t> dist( n, numeric_limits<uint64_t>::max( ) );
+    Heap h;
+    long long pops = 0;
+
+    Timer timer;
+    dist[ 0 ] = 0;
+    h.insert( Entry{ 0, 0 } );
+    Entry top;
+    while( !h.isEmpty( ) )
+    {
+        h.deleteMin( top );
+        ++pops;
+        int v = top.second;
+        if( top.first != dist[ v ] )
+            continue;                   // stale duplicate
+        for( int e = g.first[ v ]; e < g.first[ v + 1 ]; ++e )
+        {
+            uint64_t d = top.first + g.weight[ e ];
+            if( d < dist[ g.to[ e ] ] )
+            {
+                dist[ g.to[ e ] ] = d;
+                h.insert( Entry{ d, g.to[ e ] } );
+            }
+        }
+    }
+    cout << name << "\t" << timer.elapsedMillis( ) << "\t" << pops << endl;
+    return dist;
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int n = argc > 1 ? atoi( argv[ 1 ] ) : 1000000;
+    int degree = argc > 2 ? atoi( argv[ 2 ] ) : 8;
+
+    UniformRandom r{ 107 };
+    for( int maxWeight : { 1000, 1 << 24 } )
+    {
+        Graph g;
+        for( int v = 0; v < n; ++v )
+        {
+            g.first.push_back( g.to.size( ) );
+            for( int e = 0; e < degree; ++e )
+            {
+                g.to.push_back( r.nextInt( n ) );
+                g.weight.push_back( r.nextInt( 1, maxWeight ) );
+            }
+        }
+        g.first.push_back( g.to.size( ) );
+
+        cout << "Dijkstra, " << n << " vertices, " << n * degree
+             << " edges, weights 1.." << maxWeight << endl;
+        cout << "heap\t\tms\tdeleteMins" << endl;
+        vector<uint64_t> expected = dijkstra<BinaryHeap<Entry>>( g, "BinaryHeap" );
+        if( dijkstra<DaryHeap<Entry, 4>>( g, "DaryHeap<4>" ) != expected )
+            cout << "Oops! DaryHeap distances differ" << endl;
+        if( dijkstra<RadixHeap<Entry>>( g, "RadixHeap" ) != expected )
+            cout << "Oops! RadixHeap distances differ" << endl;
+        cout << endl;
+    }
+    return 0;
+}
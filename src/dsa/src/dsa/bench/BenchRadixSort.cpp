@@ -0,0 +1,67 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "RadixSort.H"
+#include "Sort_sol.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Compares lsdRadixSort with quicksort and std::sort on random keys.
+// Usage: BenchRadixSort [numItems]
+
+template <typename Key>
+void run( const char *name, const vector<Key> & input )
+{
+    vector<Key> a = input;
+    Timer timer;
+    quicksort( a );
+    double qs = timer.elapsedMillis( );
+
+    a = input;
+    timer.reset( );
+    sort( begin( a ), end( a ) );
+    double stdSort = timer.elapsedMillis( );
+
+    a = input;
+    timer.reset( );
+    lsdRadixSort<8>( a );
+    double radix8 = timer.elapsedMillis( );
+
+    a = input;
+    timer.reset( );
+    lsdRadixSort<11>( a );
+    double radix11 = timer.elapsedMillis( );
+
+    if( !is_sorted( begin( a ), end( a ) ) )
+        cout << "Oops! not sorted" << endl;
+    cout << name << "\t" << qs << "\t\t" << stdSort << "\t\t"
+         << radix8 << "\t\t" << radix11 << endl;
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int numItems = argc > 1 ? atoi( argv[ 1 ] ) : 5000000;
+
+    UniformRandom r{ 19 };
+    vector<int> ints( numItems );
+    vector<uint64_t> longs( numItems );
+    vector<float> floats( numItems );
+    vector<double> doubles( numItems );
+    for( int i = 0; i < numItems; ++i )
+    {
+        ints[ i ] = r.nextInt( );
+        longs[ i ] = static_cast<uint64_t>( r.nextInt( ) ) << 32 | r.nextInt( );
+        doubles[ i ] = r.nextDouble( ) - 0.5;
+        floats[ i ] = static_cast<float>( doubles[ i ] );
+    }
+
+    cout << numItems << " keys\tquicksort ms\tstd::sort ms\tradix<8> ms\tradix<11> ms" << endl;
+    run( "int", ints );
+    run( "uint64_t", longs );
+    run( "float", floats );
+    run( "double", doubles );
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "ExternalSort.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// Compares fixed-size chunk sorting with replacement selection as the
+// run generator of an external sort of 100-byte records: runs formed,
+// merge passes, bytes written and time, on random and nearly sorted keys.
+// Usage: BenchReplacementSelection [numRecords] [memoryMB] [fanIn] [tempDir]
+
+struct Record
+{
+    uint64_t key;
+    char     payload[ 92 ];
+
+    bool operator<( const Record & rhs ) const
+      { return key < rhs.key; }
+};
+
+void run( const char *name, const char *mode, const string & inName, const string & outName,
+          size_t memory, int fanIn, const string & dir, bool replacement )
+{
+    ExternalSorter<Record> sorter( memory, dir, fanIn );
+    sorter.setReplacementSelection( replacement );
+    sorter.sort( inName, outName );
+
+    const ExternalSortStats & s = sorter.stats( );
+    cout << name << "\t" << mode << "\t" << s.runs << "\t"
+         << s.totalRecords / max( s.runs, 1 ) << "\t\t" << s.mergePasses << "\t"
+         << s.bytesWritten / 1e6 << "\t\t" << s.runSeconds << "\t"
+         << s.elapsedSeconds( ) << endl;
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int numRecords = argc > 1 ? atoi( argv[ 1 ] ) : 2000000;
+    int memoryMB = argc > 2 ? atoi( argv[ 2 ] ) : 4;
+    int fanIn = argc > 3 ? atoi( argv[ 3 ] ) : 32;
+    string dir = argc > 4 ? argv[ 4 ] : "/tmp";
+    string inName = dir + "/BenchReplacementSelection.in";
+    string outName = dir + "/BenchReplacementSelection.out";
+    size_t memory = static_cast<size_t>( memoryMB ) << 20;
+
+    cout << numRecords << " records (" << numRecords * sizeof( Record ) / 1e6
+         << " MB), " << memoryMB << " MB budget, fan-in " << fanIn << endl;
+    cout << "input\truns by\t\truns\tavg length\tpasses\tMB written\trun s\ttotal s" << endl;
+
+    UniformRandom r{ 37 };
+    for( int nearlySorted = 0; nearlySorted < 2; ++nearlySorted )
+    {
+        {
+            ofstream out( inName, ios::binary );
+            Record rec{ };
+            for( int i = 0; i < numRecords; ++i )
+            {
+                if( nearlySorted )      // ascending, with local disorder
+                    rec.key = static_cast<uint64_t>( i ) * 1000 + r.nextInt( 1000000 );
+                else
+                    rec.key = static_cast<uint64_t>( r.nextInt( ) ) << 32 | r.nextInt( );
+                out.write( reinterpret_cast<const char *>( &rec ), sizeof( rec ) );
+            }
+        }
+
+        const char *name = nearlySorted ? "nearly" : "random";
+        run( name, "chunks\t", inName, outName, memory, fanIn, dir, false );
+        run( name, "replacement", inName, outName, memory, fanIn, dir, true );
+    }
+
+    remove( inName.c_str( ) );
+    remove( outName.c_str( ) );
+    return 0;
+}
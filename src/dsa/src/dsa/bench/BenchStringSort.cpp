@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "RadixSort.H"
+#include "Sort_sol.H"
+#include "Timer.H"
+#include "UniformRandom.H"
+using namespace std;
+
+// String sort throughput (MB of key bytes per second) on
+// variable-length key distributions.
+// Usage: BenchStringSort [numItems]
+
+static UniformRandom r{ 23 };
+
+string randomWord( int len )
+{
+    string s;
+    for( int j = 0; j < len; ++j )
+        s += static_cast<char>( 'a' + r.nextInt( 26 ) );
+    return s;
+}
+
+/**
+ * URLs: a few hosts, a handful of path segments and an occasional
+ * long query string, giving lengths from 8 to 2000 characters.
+ */
+vector<string> urls( int n )
+{
+    vector<string> hosts;
+    for( int i = 0; i < 50; ++i )
+        hosts.push_back( "https://www." + randomWord( r.nextInt( 3, 12 ) ) + ".com" );
+
+    vector<string> keys( n );
+    for( auto & s : keys )
+    {
+        s = hosts[ r.nextInt( hosts.size( ) ) ];
+        int segments = r.nextInt( 0, 6 );
+        for( int k = 0; k < segments; ++k )
+            s += "/" + randomWord( r.nextInt( 2, 12 ) );
+        if( r.nextInt( 10 ) == 0 )
+            s += "?q=" + randomWord( r.nextInt( 10, 1900 ) );
+        if( s.size( ) > 2000 )
+            s.resize( 2000 );
+    }
+    return keys;
+}
+
+/**
+ * Log keys: timestamp, service and request path; long shared prefixes.
+ */
+vector<string> logKeys( int n )
+{
+    vector<string> keys( n );
+    for( auto & s : keys )
+        s = "2026-10-17T" + to_string( 10 + r.nextInt( 14 ) ) + ":" +
+            to_string( 10 + r.nextInt( 50 ) ) + ":" + to_string( 10 + r.nextInt( 50 ) ) +
+            " svc-" + to_string( r.nextInt( 8 ) ) + " GET /api/v1/" +
+            randomWord( r.nextInt( 4, 40 ) );
+    return keys;
+}
+
+vector<string> randomKeys( int n )
+{
+    vector<string> keys( n );
+    for( auto & s : keys )
+        s = randomWord( r.nextInt( 8, 64 ) );
+    return keys;
+}
+
+template <typename Sorter>
+void run( const char *name, const vector<string> & input, double megabytes, Sorter sorter )
+{
+    vector<string> a = input;
+    Timer timer;
+    sorter( a );
+    double elapsed = timer.elapsedMillis( );
+
+    if( !is_sorted( begin( a ), end( a ) ) )
+        cout << "Oops! not sorted" << endl;
+    cout << "  " << name << "\t" << elapsed << " ms\t" << megabytes / elapsed * 1000 << " MB/s" << endl;
+}
+
+void runAll( const char *name, const vector<string> & input )
+{
+    double bytes = 0;
+    int maxLen = 0;
+    for( auto & s : input )
+    {
+        bytes += s.size( );
+        maxLen = max( maxLen, static_cast<int>( s.size( ) ) );
+    }
+    double megabytes = bytes / 1e6;
+
+    cout << name << ": " << input.size( ) << " keys, " << megabytes << " MB" << endl;
+    run( "std::sort\t", input, megabytes, []( vector<string> & a ) { sort( begin( a ), end( a ) ); } );
+    run( "quicksort\t", input, megabytes, []( vector<string> & a ) { quicksort( a ); } );
+    run( "radixSort(maxLen)", input, megabytes, [ maxLen ]( vector<string> & a ) { radixSort( a, maxLen ); } );
+    run( "multikeyQuicksort", input, megabytes, []( vector<string> & a ) { multikeyQuicksort( a ); } );
+    run( "msdRadixSort\t", input, megabytes, []( vector<string> & a ) { msdRadixSort( a ); } );
+}
+
+int main( int argc, char *argv[ ] )
+{
+    int numItems = argc > 1 ? atoi( argv[ 1 ] ) : 500000;
+
+    runAll( "urls", urls( numItems ) );
+    runAll( "log keys", logKeys( numItems ) );
+    runAll( "random", randomKeys( numItems ) );
+    return 0;
+}
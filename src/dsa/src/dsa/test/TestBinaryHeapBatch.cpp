@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BinaryHeap_sol.H"
+#include "UniformRandom.H"
+using namespace std;
+
+    // Drain h and compare with the sorted reference
+template <typename Comparable>
+void checkDrain( BinaryHeap<Comparable> & h, vector<Comparable> expected, const char *what )
+{
+    sort( begin( expected ), end( expected ) );
+    Comparable x;
+    for( size_t i = 0; i < expected.size( ); ++i )
+    {
+        if( h.isEmpty( ) )
+        {
+            cout << "Oops! " << what << " lost items" << endl;
+            return;
+        }
+        h.deleteMin( x );
+        if( x != expected[ i ] )
+        {
+            cout << "Oops! " << what << " out of order at " << i << endl;
+            return;
+        }
+    }
+    if( !h.isEmpty( ) )
+        cout << "Oops! " << what << " has extra items" << endl;
+}
+
+    // Test program
+int main( )
+{
+    UniformRandom r{ 71 };
+
+    cout << "Begin test... " << endl;
+
+        // Batches of every size into heaps of every size take both paths
+    for( int n : { 0, 1, 5, 1000, 50000 } )
+        for( int m : { 0, 1, 3, 30, 1000, 100000 } )
+        {
+            BinaryHeap<int> h{ 1 };
+            vector<int> all;
+            for( int i = 0; i < n; ++i )
+            {
+                all.push_back( r.nextInt( 1000000 ) );
+                h.insert( all.back( ) );
+            }
+            vector<int> batch( m );
+            for( auto & x : batch )
+                x = r.nextInt( 1000000 );
+            h.insertBatch( batch );
+            all.insert( all.end( ), batch.begin( ), batch.end( ) );
+            checkDrain( h, all, "insertBatch" );
+        }
+
+        // popN takes the k smallest in order and leaves a valid heap
+    for( int n : { 1, 10, 1000, 50000 } )
+        for( int k : { 0, 1, 2, 7, n / 2, n - 1, n, n + 5 } )
+        {
+            vector<int> all( n );
+            for( auto & x : all )
+                x = r.nextInt( n );              // duplicates
+            BinaryHeap<int> h{ all };
+            vector<int> out{ -1 };
+            int taken = h.popN( k, out );
+
+            vector<int> sorted = all;
+            sort( begin( sorted ), end( sorted ) );
+            int expectTaken = max( 0, min( k, n ) );
+            if( taken != expectTaken || out.size( ) != size_t( expectTaken + 1 ) || out[ 0 ] != -1 ||
+                !equal( out.begin( ) + 1, out.end( ), sorted.begin( ) ) )
+            {
+                cout << "Oops! popN " << n << " " << k << endl;
+                continue;
+            }
+            checkDrain( h, vector<int>( sorted.begin( ) + expectTaken, sorted.end( ) ), "popN rest" );
+        }
+
+        // Interleaved batches and pops of strings
+    BinaryHeap<string> s;
+    vector<string> live;
+    for( int round = 0; round < 50; ++round )
+    {
+        vector<string> batch( r.nextInt( 1, 2000 ) );
+        for( auto & x : batch )
+            x = to_string( r.nextInt( ) );
+        s.insertBatch( batch.begin( ), batch.end( ) );
+        live.insert( live.end( ), batch.begin( ), batch.end( ) );
+
+        vector<string> out;
+        int k = r.nextInt( 1500 );
+        s.popN( k, out );
+        sort( begin( live ), end( live ) );
+        if( !equal( out.begin( ), out.end( ), live.begin( ) ) )
+            cout << "Oops! string popN round " << round << endl;
+        live.erase( live.begin( ), live.begin( ) + out.size( ) );
+    }
+    checkDrain( s, live, "strings" );
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
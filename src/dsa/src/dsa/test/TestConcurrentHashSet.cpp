@@ -0,0 +1,85 @@
+#include <atomic>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ConcurrentHashSet.H"
+#include "HashTableChecks.H"
+#include "UniformRandom.H"
+using namespace std;
+
+    // Writers insert and remove their own keys, growing every shard,
+    // while readers check keys that never change: the even ones below
+    // STABLE are always present and the odd ones never are
+void checkConcurrent( int writers, int readers )
+{
+    const int STABLE = 20000;
+    const int PER_WRITER = 50000;
+    ConcurrentHashSet<int> h{ 8 };
+    for( int i = 0; i < STABLE; i += 2 )
+        h.insert( i );
+
+    atomic<bool> done{ false };
+    atomic<int> wrong{ 0 };
+    vector<thread> threads;
+    for( int t = 0; t < readers; ++t )
+        threads.emplace_back( [ &, t ]
+        {
+            UniformRandom r{ 89 + t };
+            while( !done.load( ) )
+            {
+                int x = r.nextInt( STABLE );
+                if( h.contains( x ) != ( x % 2 == 0 ) )
+                    ++wrong;
+            }
+        } );
+    vector<thread> writing;
+    for( int t = 0; t < writers; ++t )
+        writing.emplace_back( [ &, t ]
+        {
+            int base = STABLE + t * PER_WRITER;
+            for( int i = 0; i < PER_WRITER; ++i )
+            {
+                if( !h.insert( base + i ) || h.insert( base + i ) )
+                    ++wrong;
+                if( i % 2 == 1 && !h.remove( base + i - 1 ) )
+                    ++wrong;
+            }
+        } );
+    for( auto & th : writing )
+        th.join( );
+    done = true;
+    for( auto & th : threads )
+        th.join( );
+
+    if( wrong != 0 )
+        cout << "Oops! " << wrong << " wrong answers" << endl;
+    if( h.size( ) != STABLE / 2 + writers * PER_WRITER / 2 )
+        cout << "Oops! size " << h.size( ) << endl;
+    for( int i = STABLE; i < STABLE + writers * PER_WRITER; ++i )
+        if( h.contains( i ) != ( i % 2 == 1 ) )
+        {
+            cout << "Oops! final contains " << i << endl;
+            break;
+        }
+}
+
+    // Test program
+int main( )
+{
+    cout << "Begin test... " << endl;
+
+    auto intKey = [ ]( int k ) { return k; };
+    auto stringKey = [ ]( int k ) { return "key" + to_string( k ); };
+    checkRandom<ConcurrentHashSet<int, PrimeSizing>>( intKey, 300000, 3000, "int", 4 );
+    checkRandom<ConcurrentHashSet<int, PowerOfTwoSizing>>( intKey, 300000, 3000, "power of 2 int", 1 );
+    checkRandom<ConcurrentHashSet<int, FastRangeSizing>>( intKey, 300000, 3000, "fast range int", 16 );
+    checkRandom<ConcurrentHashSet<string, PrimeSizing>>( stringKey, 200000, 2000, "string", 4 );
+
+    checkConcurrent( 1, 1 );
+    checkConcurrent( 4, 4 );
+    checkConcurrent( 8, 2 );
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "ConcurrentPriorityQueue.H"
+#include "UniformRandom.H"
+using namespace std;
+
+typedef ConcurrentPriorityQueue<int> Queue;
+
+    // Producers insert disjoint ranges while consumers pop; every
+    // item must come out exactly once
+void checkConcurrent( Queue::Mode mode, int numThreads )
+{
+    const int PER_THREAD = 20000;
+    Queue q{ 8, mode };
+    vector<atomic<int>> seen( numThreads * PER_THREAD );
+    for( auto & s : seen )
+        s = 0;
+    atomic<int> popped{ 0 };
+    atomic<bool> ordered{ true };
+
+    vector<thread> threads;
+    for( int t = 0; t < numThreads; ++t )
+        threads.emplace_back( [ &, t ]
+        {
+            for( int i = 0; i < PER_THREAD; ++i )
+            {
+                q.insert( ( i * 7919 + t ) % PER_THREAD * numThreads + t );
+                int x;
+                if( i % 2 == 1 && q.tryDeleteMin( x ) )
+                {
+                    ++seen[ x ];
+                    ++popped;
+                }
+            }
+        } );
+    for( auto & th : threads )
+        th.join( );
+    threads.clear( );
+
+        // Drain concurrently; in STRICT mode each consumer sees a rising sequence
+    for( int t = 0; t < numThreads; ++t )
+        threads.emplace_back( [ & ]
+        {
+            int x, last = -1;
+            while( q.tryDeleteMin( x ) )
+            {
+                ++seen[ x ];
+                ++popped;
+                if( mode == Queue::STRICT && x < last )
+                    ordered = false;
+                last = x;
+            }
+        } );
+    for( auto & th : threads )
+        th.join( );
+
+    if( popped != numThreads * PER_THREAD || !q.isEmpty( ) )
+        cout << "Oops! popped " << popped << " of " << numThreads * PER_THREAD << endl;
+    for( auto & s : seen )
+        if( s != 1 )
+        {
+            cout << "Oops! an item came out " << s << " times" << endl;
+            break;
+        }
+    if( !ordered )
+        cout << "Oops! strict mode out of order" << endl;
+}
+
+    // Test program
+int main( )
+{
+    UniformRandom r{ 79 };
+
+    cout << "Begin test... " << endl;
+
+        // Single thread, STRICT: exactly sorted order
+    Queue strict{ 16, Queue::STRICT };
+    vector<int> items( 50000 );
+    for( auto & x : items )
+        x = r.nextInt( 1000 );
+    for( int x : items )
+        strict.insert( x );
+    sort( begin( items ), end( items ) );
+    int x;
+    for( size_t i = 0; i < items.size( ); ++i )
+        if( !strict.tryDeleteMin( x ) || x != items[ i ] )
+        {
+            cout << "Oops! strict order at " << i << endl;
+            break;
+        }
+    if( strict.tryDeleteMin( x ) || !strict.isEmpty( ) )
+        cout << "Oops! strict queue not empty" << endl;
+
+        // Single thread, RELAXED: a permutation, close to sorted
+    Queue relaxed{ 16 };
+    for( int i = 0; i < 50000; ++i )
+        relaxed.insert( i );
+    vector<int> out;
+    while( relaxed.tryDeleteMin( x ) )
+        out.push_back( x );
+    long long displacement = 0;
+    for( int i = 0; i < int( out.size( ) ); ++i )
+        displacement += abs( out[ i ] - i );
+    sort( begin( out ), end( out ) );
+    for( int i = 0; i < int( out.size( ) ); ++i )
+        if( out[ i ] != i )
+        {
+            cout << "Oops! relaxed queue lost " << i << endl;
+            break;
+        }
+    if( out.size( ) != 50000 || displacement > 50000LL * 100 )
+        cout << "Oops! relaxed order too loose: " << displacement << endl;
+
+    relaxed.insert( 3 );
+    relaxed.makeEmpty( );
+    if( !relaxed.isEmpty( ) || relaxed.tryDeleteMin( x ) )
+        cout << "Oops! makeEmpty" << endl;
+
+    for( int numThreads : { 1, 2, 4, 8 } )
+    {
+        checkConcurrent( Queue::RELAXED, numThreads );
+        checkConcurrent( Queue::STRICT, numThreads );
+    }
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
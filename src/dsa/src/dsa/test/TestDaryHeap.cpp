@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+#include "DaryHeap.H"
+#include "UniformRandom.H"
+using namespace std;
+
+template <int D>
+void testStrings( )
+{
+    int minItem = 10000;  // same number of digits
+    int maxItem = 99999;
+    DaryHeap<string, D> h;
+    string x;
+
+    for( int i = 37; i != 0; i = ( i + 37 ) % maxItem )
+        if( i >= minItem )
+            h.insert( "hello" + to_string( i ) );
+    for( int i = minItem; i < maxItem; ++i )
+    {
+        h.deleteMin( x );
+        if( x != "hello" + to_string( i ) )
+            cout << "Oops! D=" << D << " " << i << endl;
+    }
+    if( !h.isEmpty( ) )
+        cout << "Oops! D=" << D << " not empty" << endl;
+}
+
+template <int D>
+void testInts( UniformRandom & r )
+{
+    vector<int> items( 50000 );
+    for( auto & x : items )
+        x = r.nextInt( 1000 );
+
+        // Interleaved pushes and pops against a sorted reference
+    DaryHeap<int, D> h{ 1 };
+    multiset<int> pending;
+    for( size_t i = 0; i < items.size( ); ++i )
+    {
+        h.insert( items[ i ] );
+        pending.insert( items[ i ] );
+        if( i % 3 == 2 )
+        {
+            if( h.findMin( ) != *pending.begin( ) )
+                cout << "Oops! D=" << D << " findMin " << i << endl;
+            h.deleteMin( );
+            pending.erase( pending.begin( ) );
+        }
+    }
+
+    DaryHeap<int, D> built{ items };
+    sort( begin( items ), end( items ) );
+    int x;
+    for( size_t i = 0; i < items.size( ); ++i )
+    {
+        built.deleteMin( x );
+        if( x != items[ i ] )
+        {
+            cout << "Oops! D=" << D << " buildHeap order " << i << endl;
+            break;
+        }
+    }
+
+    built.makeEmpty( );
+    try
+    {
+        built.deleteMin( );
+        cout << "Oops! D=" << D << " deleteMin on empty heap" << endl;
+    }
+    catch( const UnderflowException & e )
+    {
+    }
+}
+
+    // Test program
+int main( )
+{
+    UniformRandom r{ 47 };
+
+    cout << "Begin test... " << endl;
+
+    testStrings<2>( );
+    testStrings<4>( );
+    testStrings<8>( );
+    testInts<2>( r );
+    testInts<3>( r );
+    testInts<4>( r );
+    testInts<8>( r );
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <dirent.h>
+#include "ExternalSort.H"
+#include "UniformRandom.H"
+using namespace std;
+
+struct Record
+{
+    int  key;
+    int  seq;
+    char payload[ 8 ];
+
+    bool operator<( const Record & rhs ) const
+      { return key < rhs.key; }
+};
+
+template <typename T>
+void writeFile( const string & name, const vector<T> & a )
+{
+    ofstream out( name, ios::binary );
+    out.write( reinterpret_cast<const char *>( a.data( ) ), a.size( ) * sizeof( T ) );
+}
+
+template <typename T>
+vector<T> readFile( const string & name )
+{
+    ifstream in( name, ios::binary | ios::ate );
+    vector<T> a( in.tellg( ) / sizeof( T ) );
+    in.seekg( 0 );
+    in.read( reinterpret_cast<char *>( a.data( ) ), a.size( ) * sizeof( T ) );
+    return a;
+}
+
+    // Number of entries in dir, not counting . and ..
+int countFiles( const string & dir )
+{
+    int count = 0;
+    DIR *d = opendir( dir.c_str( ) );
+    while( dirent *e = readdir( d ) )
+        if( strcmp( e->d_name, "." ) != 0 && strcmp( e->d_name, ".." ) != 0 )
+            ++count;
+    closedir( d );
+    return count;
+}
+
+    // Test program
+int main( )
+{
+    UniformRandom r{ 23 };
+    const string inName = "/tmp/TestExternalSort.in";
+    const string outName = "/tmp/TestExternalSort.out";
+
+    cout << "Begin test... " << endl;
+
+        // Budget, fan-in: one run; many runs in one pass; several passes
+    int budgets[ ] = { 1 << 24, 1 << 16, 1 << 12 };
+    int fanIns[ ] = { 64, 64, 3 };
+    for( int n : { 0, 1, 1000, 100000 } )
+        for( int t = 0; t < 3; ++t )
+        {
+            vector<int> a( n );
+            for( auto & x : a )
+                x = r.nextInt( );
+            writeFile( inName, a );
+
+            int reports = 0;
+            ExternalSorter<int> sorter( budgets[ t ], "/tmp", fanIns[ t ] );
+            sorter.setProgress( [ & ]( const ExternalSortStats & ) { ++reports; } );
+            sorter.sort( inName, outName );
+
+            sort( begin( a ), end( a ) );
+            if( readFile<int>( outName ) != a )
+                cout << "Oops! external sort " << n << " " << t << endl;
+
+            const ExternalSortStats & s = sorter.stats( );
+            if( s.totalRecords != n || s.outputRecords != n || s.fractionDone( ) != 1.0 )
+                cout << "Oops! bad record counts " << n << " " << t << endl;
+            if( s.bytesWritten != s.recordsWritten * static_cast<long long>( sizeof( int ) ) )
+                cout << "Oops! bad byte counts " << n << " " << t << endl;
+            if( n > 0 && ( reports < s.runs || s.mergePasses < 1 ) )
+                cout << "Oops! no progress reports " << n << " " << t << endl;
+            if( t == 2 && n == 100000 && s.mergePasses < 3 )
+                cout << "Oops! expected several merge passes" << endl;
+        }
+
+        // Wide records with many equal keys: the sort is stable
+    vector<Record> recs( 50000 );
+    for( size_t i = 0; i < recs.size( ); ++i )
+    {
+        recs[ i ] = Record{ r.nextInt( 100 ), int( i ), { } };
+        recs[ i ].payload[ 0 ] = static_cast<char>( i );
+    }
+    writeFile( inName, recs );
+    ExternalSorter<Record> recSorter( 1 << 14, "/tmp", 4 );
+    recSorter.sort( inName, outName );
+    vector<Record> sorted = readFile<Record>( outName );
+    if( sorted.size( ) != recs.size( ) )
+        cout << "Oops! lost records" << endl;
+    for( size_t i = 1; i < sorted.size( ); ++i )
+        if( sorted[ i ] < sorted[ i - 1 ] ||
+            ( sorted[ i ].key == sorted[ i - 1 ].key && sorted[ i ].seq < sorted[ i - 1 ].seq ) ||
+            sorted[ i ].payload[ 0 ] != static_cast<char>( sorted[ i ].seq ) )
+        {
+            cout << "Oops! external sort is not stable at " << i << endl;
+            break;
+        }
+
+        // A failure halfway through a merge pass leaves no run files,
+        // neither those of the pass nor those it has already merged.
+        // Runs of 128K ints, merged three at a time, so the second
+        // merge reports (and throws) when it first fills the buffer
+    vector<int> a( 7 << 17 );
+    for( auto & x : a )
+        x = r.nextInt( );
+    writeFile( inName, a );
+    char tempDir[ ] = "/tmp/TestExternalSort.XXXXXX";
+    if( mkdtemp( tempDir ) == nullptr )
+        cout << "Oops! cannot make a temporary directory" << endl;
+    ExternalSorter<int> failing( 1 << 20, tempDir, 3 );
+    failing.setProgress( [ ]( const ExternalSortStats & s )
+    {
+        if( s.mergePasses == 0 && s.recordsWritten > s.totalRecords * 3 / 2 )
+            throw IOException{ };
+    } );
+    try
+    {
+        failing.sort( inName, outName );
+        cout << "Oops! progress exception swallowed" << endl;
+    }
+    catch( const IOException & e )
+    {
+    }
+    if( countFiles( tempDir ) != 0 )
+        cout << "Oops! " << countFiles( tempDir ) << " run files left behind" << endl;
+    rmdir( tempDir );
+
+        // Partial records and missing files are errors
+    ofstream( inName, ios::binary ) << "abcdefg";
+    try
+    {
+        ExternalSorter<int>{ }.sort( inName, outName );
+        cout << "Oops! partial record accepted" << endl;
+    }
+    catch( const IOException & e )
+    {
+    }
+    try
+    {
+        ExternalSorter<int>{ }.sort( "/tmp/no/such/file", outName );
+        cout << "Oops! missing file accepted" << endl;
+    }
+    catch( const IOException & e )
+    {
+    }
+
+    remove( inName.c_str( ) );
+    remove( outName.c_str( ) );
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
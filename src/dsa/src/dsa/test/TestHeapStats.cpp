@@ -0,0 +1,162 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BinaryHeap_sol.H"
+#include "BinomialQueue_sol.H"
+#include "LeftistHeap.H"
+#include "UniformRandom.H"
+using namespace std;
+
+    // An int that counts every comparison made on it
+struct Counted
+{
+    static unsigned long long compares;
+    int value;
+
+    Counted( int v = 0 ) : value{ v } { }
+
+    bool operator<( const Counted & rhs ) const
+    {
+        ++compares;
+        return value < rhs.value;
+    }
+};
+
+unsigned long long Counted::compares = 0;
+
+unsigned long long depthTotal( const HeapStatistics & s )
+{
+    unsigned long long total = 0;
+    for( int d = 0; d < HeapStatistics::DEPTH_BUCKETS; ++d )
+        total += s.depths[ d ];
+    return total;
+}
+
+bool isZero( const HeapStatistics & s )
+{
+    return s.comparisons == 0 && s.moves == 0 && s.resizes == 0 &&
+           s.allocations == 0 && depthTotal( s ) == 0;
+}
+
+    // The comparison counter must see every comparison the heap makes
+template <typename Heap>
+void checkComparisons( const vector<int> & items, const string & what )
+{
+    Heap h;
+    Counted::compares = 0;
+    Counted x;
+    for( size_t i = 0; i < items.size( ); ++i )
+    {
+        h.insert( Counted{ items[ i ] } );
+        if( i % 3 == 2 )
+            h.deleteMin( x );
+    }
+    while( !h.isEmpty( ) )
+        h.deleteMin( x );
+
+    HeapStatistics s = h.statistics( );
+    if( s.comparisons != Counted::compares )
+        cout << "Oops! " << what << " counted " << s.comparisons
+             << " comparisons, made " << Counted::compares << endl;
+    if( s.comparisons == 0 || s.moves == 0 || depthTotal( s ) == 0 )
+        cout << "Oops! " << what << " counted nothing" << endl;
+
+    h.resetStatistics( );
+    if( !isZero( h.statistics( ) ) )
+        cout << "Oops! " << what << " resetStatistics" << endl;
+}
+
+    // Test program
+int main( )
+{
+    UniformRandom r{ 29 };
+    vector<int> items( 10000 );
+    for( auto & x : items )
+        x = r.nextInt( 1000 );
+
+    cout << "Begin test... " << endl;
+
+        // Disabled statistics stay zero and cost no space
+    {
+        BinaryHeap<int> h;
+        LeftistHeap<int> lh;
+        BinomialQueue<int> bq;
+        for( int i = 0; i < 100; ++i )
+        {
+            h.insert( items[ i ] );
+            lh.insert( items[ i ] );
+            bq.insert( items[ i ] );
+        }
+        if( !isZero( h.statistics( ) ) || !isZero( lh.statistics( ) ) ||
+            !isZero( bq.statistics( ) ) )
+            cout << "Oops! NoHeapStats counted" << endl;
+        if( sizeof( BinaryHeap<int> ) != sizeof( int ) + sizeof( int ) + sizeof( vector<int> ) )
+            cout << "Oops! BinaryHeap grew: " << sizeof( BinaryHeap<int> ) << endl;
+    }
+
+        // BinaryHeap: hand-counted percolations
+    {
+        BinaryHeap<int, HeapStats> h{ 1 };
+        h.insert( 3 );      // no parent
+        h.insert( 2 );      // grows, rises one level
+        h.insert( 1 );      // rises one level
+        HeapStatistics s = h.statistics( );
+        if( s.comparisons != 2 || s.moves != 2 || s.resizes != 1 || s.allocations != 1 ||
+            s.depths[ 0 ] != 1 || s.depths[ 1 ] != 2 || depthTotal( s ) != 3 )
+            cout << "Oops! BinaryHeap small counts" << endl;
+
+            // Ascending inserts compare once with the parent (the root
+            // with the sentinel in array[ 0 ]) and stay put
+        BinaryHeap<int, HeapStats> up;
+        for( int i = 0; i < 1000; ++i )
+            up.insert( i );
+        s = up.statistics( );
+        if( s.comparisons != 1000 || s.moves != 0 || s.depths[ 0 ] != 1000 )
+            cout << "Oops! BinaryHeap ascending counts" << endl;
+
+            // Descending inserts rise to the root: floor( log2( i ) ) levels
+        BinaryHeap<int, HeapStats> down;
+        unsigned long long levels = 0;
+        for( int i = 1; i <= 1000; ++i )
+        {
+            down.insert( -i );
+            for( int j = i; j > 1; j /= 2 )
+                ++levels;
+        }
+        s = down.statistics( );
+        if( s.moves != levels || s.depths[ 9 ] != 1000 - 511 )
+            cout << "Oops! BinaryHeap descending counts" << endl;
+    }
+
+        // BinomialQueue: 7 inserts into an empty queue carry like 1..7 in binary
+    {
+        BinomialQueue<int, NewDeleteNodes, HeapStats> q;
+        for( int i = 0; i < 7; ++i )
+            q.insert( i );
+        HeapStatistics s = q.statistics( );
+        if( s.comparisons != 4 || s.moves != 4 || s.resizes != 2 || s.allocations != 7 ||
+            s.depths[ 0 ] != 4 || s.depths[ 1 ] != 2 || s.depths[ 2 ] != 1 )
+            cout << "Oops! BinomialQueue small counts" << endl;
+
+        BinomialQueue<int, NewDeleteNodes, HeapStats> copy = q;
+        if( copy.statistics( ).allocations != 7 )
+            cout << "Oops! BinomialQueue copy allocations" << endl;
+    }
+
+        // LeftistHeap: one allocation per item, one merge per insert
+    {
+        LeftistHeap<int, NodePool, HeapStats> h;
+        for( int i = 0; i < 1000; ++i )
+            h.insert( items[ i ] );
+        HeapStatistics s = h.statistics( );
+        if( s.allocations != 1000 || s.resizes != 0 || depthTotal( s ) != 999 )
+            cout << "Oops! LeftistHeap insert counts" << endl;
+    }
+
+    checkComparisons<BinaryHeap<Counted, HeapStats>>( items, "BinaryHeap" );
+    checkComparisons<LeftistHeap<Counted, NewDeleteNodes, HeapStats>>( items, "LeftistHeap" );
+    checkComparisons<BinomialQueue<Counted, NewDeleteNodes, HeapStats>>( items, "BinomialQueue" );
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
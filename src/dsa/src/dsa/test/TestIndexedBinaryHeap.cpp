@@ -0,0 +1,130 @@
+#include <iostream>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include "IndexedBinaryHeap.H"
+#include "UniformRandom.H"
+using namespace std;
+
+    // Test program
+int main( )
+{
+    UniformRandom r{ 61 };
+    IndexedBinaryHeap<int> h{ 4 };
+    map<int, int> keyOf;               // handle -> key
+    set<pair<int, int>> byKey;          // (key, handle)
+
+    cout << "Begin test... " << endl;
+
+    for( int step = 0; step < 200000; ++step )
+    {
+        int op = r.nextInt( 10 );
+        if( op < 4 || keyOf.empty( ) )
+        {
+            int x = r.nextInt( 100000 );
+            int handle = h.insert( x );
+            if( keyOf.count( handle ) )
+                cout << "Oops! live handle reused " << handle << endl;
+            keyOf[ handle ] = x;
+            byKey.insert( { x, handle } );
+            continue;
+        }
+
+        auto it = keyOf.lower_bound( r.nextInt( 0, keyOf.rbegin( )->first ) );
+        int handle = it->first, old = it->second;
+        if( h.get( handle ) != old )
+            cout << "Oops! get " << handle << endl;
+        byKey.erase( { old, handle } );
+
+        if( op < 6 )
+        {
+            int x = old - r.nextInt( 1000 );
+            h.decreaseKey( handle, x );
+            it->second = x;
+            byKey.insert( { x, handle } );
+        }
+        else if( op < 8 )
+        {
+            int x = old + r.nextInt( 1000 );
+            h.increaseKey( handle, x );
+            it->second = x;
+            byKey.insert( { x, handle } );
+        }
+        else if( op == 8 )
+        {
+            h.erase( handle );
+            keyOf.erase( it );
+            if( h.contains( handle ) )
+                cout << "Oops! erased handle still present" << endl;
+        }
+        else
+        {
+            byKey.insert( { old, handle } );
+            int minItem, minHandle = h.findMinHandle( );
+            h.deleteMin( minItem );
+            if( minItem != byKey.begin( )->first || keyOf[ minHandle ] != minItem )
+                cout << "Oops! deleteMin " << step << endl;
+            byKey.erase( { minItem, minHandle } );
+            keyOf.erase( minHandle );
+        }
+
+        if( h.size( ) != int( keyOf.size( ) ) ||
+            ( !h.isEmpty( ) && h.findMin( ) != byKey.begin( )->first ) )
+        {
+            cout << "Oops! heap out of step at " << step << endl;
+            break;
+        }
+    }
+
+        // Drain in order
+    int last = -1000000000, x;
+    while( !h.isEmpty( ) )
+    {
+        h.deleteMin( x );
+        if( x < last )
+            cout << "Oops! drained out of order" << endl;
+        last = x;
+    }
+
+    IndexedBinaryHeap<string> s;
+    int a = s.insert( "m" ), b = s.insert( "z" );
+    s.insert( "q" );
+    s.decreaseKey( b, "a" );
+    if( s.findMinHandle( ) != b || s.findMin( ) != "a" )
+        cout << "Oops! string decreaseKey" << endl;
+    s.increaseKey( b, "zz" );
+    if( s.findMin( ) != "m" )
+        cout << "Oops! string increaseKey" << endl;
+    try
+    {
+        s.decreaseKey( a, "n" );
+        cout << "Oops! decreaseKey raised a key" << endl;
+    }
+    catch( const IllegalArgumentException & e )
+    {
+    }
+    s.erase( a );
+    try
+    {
+        s.erase( a );
+        cout << "Oops! erased twice" << endl;
+    }
+    catch( const IllegalArgumentException & e )
+    {
+    }
+    s.makeEmpty( );
+    if( !s.isEmpty( ) || s.contains( b ) )
+        cout << "Oops! makeEmpty" << endl;
+    try
+    {
+        s.deleteMin( );
+        cout << "Oops! deleteMin on empty heap" << endl;
+    }
+    catch( const UnderflowException & e )
+    {
+    }
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
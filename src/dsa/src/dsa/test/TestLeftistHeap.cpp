@@ -30,6 +30,35 @@ int main( )
     if( !h1.isEmpty( ) )
         cout << "Oops! h1 should have been empty!" << endl;
 
+        // Descending inserts build a left path of every node;
+        // copying and freeing it must not recurse
+    int deepItems = 2000000;
+    LeftistHeap<int> deep;
+    for( i = deepItems; i > 0; --i )
+        deep.insert( i );
+    LeftistHeap<int> deepCopy = deep;
+    deep.makeEmpty( );
+    LeftistHeap<int> other;
+    for( i = 1; i <= deepItems; i += 2 )
+        other.insert( -i );
+    deepCopy.merge( other );
+    for( i = deepItems - 1; i >= 1; i -= 2 )
+    {
+        int x;
+        deepCopy.deleteMin( x );
+        if( x != -i )
+            cout << "Oops! deep " << x << " " << -i << endl;
+    }
+    for( i = 1; i <= deepItems; ++i )
+    {
+        int x;
+        deepCopy.deleteMin( x );
+        if( x != i )
+            cout << "Oops! deep " << x << " " << i << endl;
+    }
+    if( !deepCopy.isEmpty( ) )
+        cout << "Oops! deepCopy should have been empty!" << endl;
+
     cout << "End test... no other output is good" << endl;
 
     return 0;
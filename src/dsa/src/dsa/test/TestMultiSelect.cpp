@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Sort_sol.H"
+#include "UniformRandom.H"
+using namespace std;
+
+    // a[k-1] must be the kth smallest and split the array for every k
+template <typename Comparable>
+void checkRanks( const vector<Comparable> & a, const vector<Comparable> & sorted,
+                 const vector<int> & ranks, const char *what )
+{
+    for( int k : ranks )
+    {
+        if( a[ k - 1 ] < sorted[ k - 1 ] || sorted[ k - 1 ] < a[ k - 1 ] )
+        {
+            cout << "Oops! " << what << " wrong item at rank " << k << endl;
+            return;
+        }
+        for( int i = 0; i < int( a.size( ) ); ++i )
+            if( ( i < k - 1 && a[ k - 1 ] < a[ i ] ) || ( i > k - 1 && a[ i ] < a[ k - 1 ] ) )
+            {
+                cout << "Oops! " << what << " not split at rank " << k << endl;
+                return;
+            }
+    }
+}
+
+template <typename Comparable>
+void checkAll( const vector<Comparable> & input, const vector<int> & ranks,
+               WorkStealingPool & pool, int cutoff, const char *what )
+{
+    vector<Comparable> sorted = input;
+    sort( begin( sorted ), end( sorted ) );
+
+    for( PivotRule rule : { PivotRule::MEDIAN_OF_THREE, PivotRule::FLOYD_RIVEST } )
+    {
+        vector<Comparable> a = input;
+        multiSelect( a, ranks, rule );
+        checkRanks( a, sorted, ranks, what );
+
+        a = input;
+        parallelMultiSelect( a, ranks, pool, rule, cutoff );
+        checkRanks( a, sorted, ranks, what );
+    }
+}
+
+    // Test program
+int main( )
+{
+    UniformRandom r{ 41 };
+    const int NUM_ITEMS = 100000;
+
+    cout << "Begin test... " << endl;
+
+    vector<int> percentiles{ NUM_ITEMS / 2, NUM_ITEMS * 9 / 10,
+                             NUM_ITEMS * 99 / 100, NUM_ITEMS * 999 / 1000 };
+    vector<int> scattered{ 1, NUM_ITEMS, 7, 7, 5000, 5001, 5002, NUM_ITEMS - 1 };
+    vector<int> many;
+    for( int k = 1; k <= NUM_ITEMS; k += 997 )
+        many.push_back( k );
+
+    for( int numThreads = 1; numThreads <= 4; ++numThreads )
+    {
+        WorkStealingPool pool{ numThreads };
+
+        vector<int> a( NUM_ITEMS );
+        for( auto & x : a )
+            x = r.nextInt( );
+        checkAll( a, percentiles, pool, 2000, "random ints" );
+        checkAll( a, scattered, pool, 2000, "scattered ranks" );
+        checkAll( a, many, pool, 2000, "many ranks" );
+
+        for( auto & x : a )
+            x = r.nextInt( 3 );                 // mostly equal items
+        checkAll( a, percentiles, pool, 2000, "three values" );
+
+        vector<int> same( 20000, 5 );
+        checkAll( same, vector<int>{ 1, 7, 10000, 20000 }, pool, 1000, "all equal" );
+
+        for( int i = 0; i < NUM_ITEMS; ++i )
+            a[ i ] = NUM_ITEMS - i;
+        checkAll( a, scattered, pool, 2000, "reversed" );
+
+        vector<double> d( NUM_ITEMS );
+        for( auto & x : d )
+            x = r.nextDouble( );
+        checkAll( d, percentiles, pool, 2000, "doubles" );
+
+        vector<string> s( 5000 );
+        for( auto & x : s )
+            x = to_string( r.nextInt( 1000 ) );
+        checkAll( s, vector<int>{ 1, 2500, 4999 }, pool, 500, "strings" );
+
+        int k = NUM_ITEMS / 3;
+        for( auto & x : a )
+            x = r.nextInt( );
+        vector<int> sorted = a;
+        sort( begin( sorted ), end( sorted ) );
+        parallelQuickSelect( a, k, pool, PivotRule::FLOYD_RIVEST, 1000 );
+        checkRanks( a, sorted, vector<int>{ k }, "parallelQuickSelect" );
+    }
+
+    vector<int> tiny{ 3, 1, 2 };
+    multiSelect( tiny, vector<int>{ 1, 3 } );
+    if( tiny[ 0 ] != 1 || tiny[ 2 ] != 3 )
+        cout << "Oops! tiny" << endl;
+
+    vector<int> empty;
+    multiSelect( empty, vector<int>{ } );
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "BinomialQueue_sol.H"
+#include "LeftistHeap.H"
+#include "UniformRandom.H"
+using namespace std;
+
+    // Drain h and compare with the sorted expected items
+template <typename Heap, typename Comparable>
+void checkDrain( Heap & h, vector<Comparable> expected, const string & what )
+{
+    sort( begin( expected ), end( expected ) );
+    Comparable x;
+    for( size_t i = 0; i < expected.size( ); ++i )
+    {
+        h.deleteMin( x );
+        if( x != expected[ i ] )
+        {
+            cout << "Oops! " << what << " at " << i << endl;
+            return;
+        }
+    }
+    if( !h.isEmpty( ) )
+        cout << "Oops! " << what << " not empty" << endl;
+}
+
+template <typename Heap, typename Comparable>
+void checkHeap( const vector<Comparable> & items, const string & what )
+{
+    Heap h, h1;
+    vector<Comparable> all;
+    for( size_t i = 0; i < items.size( ); ++i )
+    {
+        if( i % 3 == 0 )
+            h1.insert( items[ i ] );
+        else
+            h.insert( items[ i ] );
+        all.push_back( items[ i ] );
+    }
+
+        // Interleave deletes with inserts, so freed nodes get reused
+    Comparable x;
+    vector<Comparable> removed;
+    for( size_t i = 0; i < items.size( ) / 4; ++i )
+    {
+        h.deleteMin( x );
+        removed.push_back( x );
+        h.insert( x );
+    }
+
+    h.merge( h1 );
+    if( !h1.isEmpty( ) )
+        cout << "Oops! " << what << " merge left rhs nonempty" << endl;
+
+        // h1 reuses its pool after giving its nodes away
+    h1.insert( items[ 0 ] );
+    h1.deleteMin( x );
+    if( x != items[ 0 ] || !h1.isEmpty( ) )
+        cout << "Oops! " << what << " reuse after merge" << endl;
+
+    Heap copy = h;
+    Heap moved = std::move( copy );
+    checkDrain( h, all, what + " merged" );
+    checkDrain( moved, all, what + " copy" );
+
+    for( const auto & item : items )
+        h.insert( item );
+    h.makeEmpty( );
+    if( !h.isEmpty( ) )
+        cout << "Oops! " << what << " makeEmpty" << endl;
+    for( const auto & item : items )
+        h.insert( item );
+    checkDrain( h, items, what + " after makeEmpty" );
+}
+
+    // Test program
+int main( )
+{
+    UniformRandom r{ 83 };
+    vector<int> ints( 20000 );
+    for( auto & x : ints )
+        x = r.nextInt( 5000 );
+    vector<string> strings;
+    for( int i = 0; i < 3000; ++i )
+        strings.push_back( "key" + to_string( r.nextInt( 1000 ) ) );
+
+    cout << "Begin test... " << endl;
+
+    checkHeap<LeftistHeap<int>>( ints, "LeftistHeap" );
+    checkHeap<LeftistHeap<int, NodePool>>( ints, "pooled LeftistHeap" );
+    checkHeap<LeftistHeap<string, NodePool>>( strings, "pooled string LeftistHeap" );
+    checkHeap<BinomialQueue<int>>( ints, "BinomialQueue" );
+    checkHeap<BinomialQueue<int, NodePool>>( ints, "pooled BinomialQueue" );
+    checkHeap<BinomialQueue<string, NodePool>>( strings, "pooled string BinomialQueue" );
+
+        // Slabs stay bounded under churn
+    LeftistHeap<int, NodePool> h;
+    for( int round = 0; round < 100; ++round )
+    {
+        for( int i = 0; i < 1000; ++i )
+            h.insert( ints[ i ] );
+        int x;
+        for( int i = 0; i < 1000; ++i )
+            h.deleteMin( x );
+    }
+    if( !h.isEmpty( ) )
+        cout << "Oops! churn heap not empty" << endl;
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
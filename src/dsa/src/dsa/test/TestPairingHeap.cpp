@@ -0,0 +1,81 @@
+#include "PairingHeap.H"
+#include <iostream>
+#include <vector>
+using namespace std;
+
+template <typename Heap>
+void test( const char *name )
+{
+    int numItems = 10000;
+    Heap h;
+    Heap h1;
+    Heap h2;
+    int i = 37;
+
+    for( i = 37; i != 0; i = ( i + 37 ) % numItems )
+        if( i % 2 == 0 )
+            h1.insert( i );
+        else
+            h.insert( i );
+    h.merge( h1 );
+    h2 = h;
+    if( h.size( ) != numItems - 1 || !h1.isEmpty( ) )
+        cout << "Oops! " << name << " sizes after merge" << endl;
+
+    for( i = 1; i < numItems; ++i )
+    {
+        int x;
+        h2.deleteMin( x );
+        if( x != i )
+            cout << "Oops! " << name << " " << i << endl;
+    }
+
+        // Every item lowered by numItems, in an order unrelated to
+        // the keys, must still come out sorted
+    vector<typename Heap::Position> p( numItems );
+    for( i = 0; i < numItems; ++i )
+        p[ i ] = h2.insert( i + 2 * numItems );
+    for( i = 37; i != 0; i = ( i + 37 ) % numItems )
+        h2.decreaseKey( p[ i ], i + numItems );
+    h2.decreaseKey( p[ 0 ], numItems );
+    for( i = numItems; i < 2 * numItems; ++i )
+    {
+        int x;
+        h2.deleteMin( x );
+        if( x != i )
+            cout << "Oops! " << name << " decreaseKey " << i << " " << x << endl;
+    }
+
+    Heap h3;
+    typename Heap::Position q = h3.insert( 5 );
+    try
+    {
+        h3.decreaseKey( q, 6 );
+        cout << "Oops! " << name << " decreaseKey raised a key" << endl;
+    }
+    catch( IllegalArgumentException & e )
+    {
+    }
+
+        // Ascending inserts give a root with one long child list;
+        // descending ones a long chain. Copies and frees must not recurse
+    Heap deep;
+    for( i = 1; i <= 1000000; ++i )
+        deep.insert( i % 2 == 0 ? i : -i );
+    Heap deepCopy = deep;
+    deep.makeEmpty( );
+    for( i = 1; i <= 1000000; ++i )
+        deepCopy.deleteMin( );
+    if( !deepCopy.isEmpty( ) || deepCopy.size( ) != 0 )
+        cout << "Oops! " << name << " deepCopy should have been empty" << endl;
+}
+
+int main( )
+{
+    cout << "Begin test..." << endl;
+    test<PairingHeap<int>>( "PairingHeap" );
+    test<PairingHeap<int, NodePool>>( "PairingHeap NodePool" );
+    cout << "End test... no other output is good" << endl;
+
+    return 0;
+}
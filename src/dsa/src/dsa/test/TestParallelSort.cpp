@@ -0,0 +1,169 @@
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "Sort_sol.H"
+#include "UniformRandom.H"
+using namespace std;
+
+struct Record
+{
+    int key;
+    int seq;
+
+    bool operator<( const Record & rhs ) const
+      { return key < rhs.key; }
+};
+
+template <typename Comparable>
+void checkSorted( const vector<Comparable> & a, const char *what )
+{
+    for( size_t i = 1; i < a.size( ); ++i )
+        if( a[ i ] < a[ i - 1 ] )
+        {
+            cout << "Oops! " << what << " unsorted at " << i << endl;
+            return;
+        }
+}
+
+    // Tasks that throw, some of them forked by other tasks: every
+    // task still runs, wait rethrows one exception, and a group left
+    // by an exception waits for its tasks without throwing
+void checkExceptions( WorkStealingPool & pool )
+{
+    atomic<int> ran{ 0 };
+    TaskGroup group{ pool };
+    for( int i = 0; i < 100; ++i )
+        group.run( [ &, i ]
+        {
+            group.run( [ &, i ]
+            {
+                ++ran;
+                if( i % 7 == 0 )
+                    throw runtime_error{ "child" };
+            } );
+            ++ran;
+            if( i % 10 == 0 )
+                throw runtime_error{ "parent" };
+        } );
+    try
+    {
+        group.wait( );
+        cout << "Oops! task exception lost" << endl;
+    }
+    catch( const runtime_error & e )
+    {
+    }
+    if( ran != 200 )
+        cout << "Oops! only " << ran << " tasks ran" << endl;
+    group.wait( );      // The exception is reported once
+
+    try
+    {
+        TaskGroup unwound{ pool };
+        for( int i = 0; i < 10; ++i )
+            unwound.run( [ &ran ]{ ++ran; throw runtime_error{ "task" }; } );
+        throw logic_error{ "caller" };
+    }
+    catch( const logic_error & e )
+    {
+    }
+    if( ran != 210 )
+        cout << "Oops! unwinding did not wait for tasks" << endl;
+}
+
+    // Test program
+int main( )
+{
+    UniformRandom r{ 1 };
+    const int NUM_ITEMS = 200000;
+
+    cout << "Begin test... " << endl;
+
+    for( int numThreads = 1; numThreads <= 4; ++numThreads )
+    {
+        WorkStealingPool pool{ numThreads };
+
+        vector<int> a( NUM_ITEMS );
+        for( auto & x : a )
+            x = r.nextInt( 1000 );        // many duplicates
+        parallelQuicksort( a, pool, 1000 );
+        checkSorted( a, "random ints" );
+
+        for( int i = 0; i < NUM_ITEMS; ++i )
+            a[ i ] = NUM_ITEMS - i;
+        parallelQuicksort( a, pool, 1000 );
+        checkSorted( a, "reversed ints" );
+        if( a[ 0 ] != 1 || a[ NUM_ITEMS - 1 ] != NUM_ITEMS )
+            cout << "Oops! lost items" << endl;
+
+        vector<string> s( 20000 );
+        for( auto & x : s )
+            x = to_string( r.nextInt( ) );
+        parallelQuicksort( s, pool, 500 );
+        checkSorted( s, "strings" );
+
+            // Small grain so that both batched and co-ranked slices run
+        vector<int> scratch;
+        for( int n : { 0, 1, 17, 1000, 4099, NUM_ITEMS } )
+        {
+            a.resize( n );
+            for( auto & x : a )
+                x = r.nextInt( 100000 );
+            vector<int> expected = a;
+            sort( begin( expected ), end( expected ) );
+            parallelMergeSort( a, scratch, pool, 256 );
+            if( a != expected )
+                cout << "Oops! parallelMergeSort " << n << endl;
+        }
+
+        const int *buffer = scratch.data( );
+        for( auto & x : a )
+            x = r.nextInt( );
+        parallelMergeSort( a, scratch, pool, 256 );
+        checkSorted( a, "parallelMergeSort reuse" );
+        if( scratch.data( ) != buffer )
+            cout << "Oops! scratch was reallocated" << endl;
+
+        vector<Record> recs( 50000 );
+        vector<Record> recScratch;
+        for( size_t i = 0; i < recs.size( ); ++i )
+            recs[ i ] = Record{ r.nextInt( 100 ), int( i ) };
+        parallelMergeSort( recs, recScratch, pool, 256 );
+        for( size_t i = 1; i < recs.size( ); ++i )
+            if( recs[ i ] < recs[ i - 1 ] ||
+                ( recs[ i ].key == recs[ i - 1 ].key && recs[ i ].seq < recs[ i - 1 ].seq ) )
+            {
+                cout << "Oops! parallelMergeSort is not stable at " << i << endl;
+                break;
+            }
+
+        vector<string> stringScratch;
+        parallelMergeSort( s, stringScratch, pool, 100 );
+        checkSorted( s, "parallelMergeSort strings" );
+
+        checkExceptions( pool );
+    }
+
+    vector<int> b( 12345 ), scratch;
+    for( auto & x : b )
+        x = r.nextInt( );
+    bottomUpMergeSort( b, scratch );
+    checkSorted( b, "bottomUpMergeSort" );
+    for( auto & x : b )
+        x = r.nextInt( );
+    mergeSort( b );
+    checkSorted( b, "mergeSort" );
+
+    vector<int> tiny{ 3, 1, 2 };
+    parallelQuicksort( tiny, 2 );
+    checkSorted( tiny, "tiny" );
+
+    vector<int> empty;
+    parallelQuicksort( empty, 2 );
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
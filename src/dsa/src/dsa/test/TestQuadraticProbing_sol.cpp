@@ -0,0 +1,87 @@
+#include <iostream>
+#include <string>
+#include "QuadraticProbing_sol.H"
+#include "HashTableChecks.H"
+using namespace std;
+
+    // Test program
+int main( )
+{
+    HashTable<int> h1;
+    HashTable<int> h2;
+
+    const int NUMS = 4000;
+    const int GAP  =   37;
+    int i;
+
+    cout << "Begin test... " << endl;
+
+    for( i = GAP; i != 0; i = ( i + GAP ) % NUMS )
+        h1.insert( i );
+
+    h2 = h1;
+
+    for( i = 1; i < NUMS; i += 2 )
+        h2.remove( i );
+    if( h2.size( ) != NUMS / 2 - 1 )
+        cout << "Oops! size after removes " << h2.size( ) << endl;
+
+    for( i = 2; i < NUMS; i += 2 )
+        if( !h2.contains( i ) )
+            cout << "Oops! contains fails " << i << endl;
+
+    for( i = 1; i < NUMS; i += 2 )
+        if( h2.contains( i ) )
+            cout << "Oops! " << i << endl;
+
+        // Reinserting a removed item reuses its slot
+    for( i = 1; i < NUMS; i += 2 )
+        if( !h2.insert( i ) || h2.insert( i ) )
+            cout << "Oops! reinsert " << i << endl;
+    if( h2.size( ) != NUMS - 1 )
+        cout << "Oops! size after reinserts " << h2.size( ) << endl;
+
+        // Sliding window: DELETED slots pile up and are cleaned in place,
+        // or by an incremental rebuild at the same size
+    for( auto mode : { HashTable<string>::BLOCKING, HashTable<string>::INCREMENTAL } )
+    {
+        HashTable<string> churn{ 101, mode };
+        for( i = 0; i < 500; ++i )
+            churn.insert( to_string( i ) );
+        for( i = 500; i < 200000; ++i )
+        {
+            if( !churn.remove( to_string( i - 500 ) ) || !churn.insert( to_string( i ) ) )
+                cout << "Oops! churn " << i << endl;
+        }
+        for( i = 200000 - 500; i < 200000; ++i )
+            if( !churn.contains( to_string( i ) ) )
+                cout << "Oops! churn lost " << i << endl;
+        if( churn.size( ) != 500 || churn.contains( "0" ) )
+            cout << "Oops! churn size" << endl;
+    }
+
+    auto intKey = [ ]( int k ) { return k; };
+    auto strideKey = [ ]( int k ) { return k << 16; };
+    auto stringKey = [ ]( int k ) { return "key" + to_string( k ); };
+    checkRandom<HashTable<int, PrimeSizing>>( intKey, 300000, 3000, "int" );
+    checkRandom<HashTable<int, PowerOfTwoSizing>>( intKey, 300000, 3000, "power of 2 int" );
+    checkRandom<HashTable<int, PowerOfTwoSizing>>( strideKey, 300000, 3000, "power of 2 stride" );
+    checkRandom<HashTable<int, FastRangeSizing>>( intKey, 300000, 3000, "fast range int" );
+    checkRandom<HashTable<string, PrimeSizing>>( stringKey, 200000, 2000, "string" );
+    checkRandom<HashTable<string, PowerOfTwoSizing>>( stringKey, 200000, 2000, "power of 2 string" );
+    checkRandom<HashTable<string, FastRangeSizing>>( stringKey, 200000, 2000, "fast range string" );
+
+    typedef HashTable<int, PrimeSizing> IntTable;
+    typedef HashTable<int, PowerOfTwoSizing> StrideTable;
+    typedef HashTable<string, PowerOfTwoSizing> StringTable;
+    checkRandom<IntTable>( intKey, 600000, 20000, "incremental int", 101, IntTable::INCREMENTAL );
+    checkRandom<StrideTable>( strideKey, 300000, 3000, "incremental power of 2 stride",
+                              101, StrideTable::INCREMENTAL );
+    checkRandom<StringTable>( stringKey, 300000, 10000, "incremental string",
+                              101, StringTable::INCREMENTAL );
+    checkGrowth<HashTable<int, PrimeSizing>>( "growth" );
+    checkGrowth<HashTable<int, PowerOfTwoSizing>>( "power of 2 growth" );
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
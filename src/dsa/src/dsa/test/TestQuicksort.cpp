@@ -0,0 +1,123 @@
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "Sort_sol.H"
+#include "UniformRandom.H"
+using namespace std;
+
+template <typename Comparable>
+void checkSorted( const vector<Comparable> & a, const string & what )
+{
+    for( size_t i = 1; i < a.size( ); ++i )
+        if( a[ i ] < a[ i - 1 ] )
+        {
+            cout << "Oops! " << what << " unsorted at " << i << endl;
+            return;
+        }
+}
+
+    // Test program
+int main( )
+{
+    UniformRandom r{ 3 };
+    const int NUM_ITEMS = 100000;
+    vector<int> a( NUM_ITEMS );
+
+    cout << "Begin test... " << endl;
+
+    for( auto & x : a )
+        x = r.nextInt( );
+    introsort( a );
+    checkSorted( a, "introsort random" );
+
+    for( auto & x : a )
+        x = r.nextInt( 10 );
+    introsort( a );
+    checkSorted( a, "introsort duplicates" );
+
+    for( int i = 0; i < NUM_ITEMS; ++i )   // organ pipe
+        a[ i ] = i < NUM_ITEMS / 2 ? i : NUM_ITEMS - i;
+    introsort( a );
+    checkSorted( a, "introsort organ pipe" );
+
+        // A zero depth limit sends the whole array to heapsort
+    for( int i = 0; i < NUM_ITEMS; ++i )
+        a[ i ] = NUM_ITEMS - i;
+    introsort( a, 0, a.size( ) - 1, 0 );
+    checkSorted( a, "introsort depth 0" );
+    if( a[ 0 ] != 1 || a[ NUM_ITEMS - 1 ] != NUM_ITEMS )
+        cout << "Oops! lost items" << endl;
+
+        // Subarray heapsort leaves the rest alone
+    vector<int> b{ 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 };
+    heapsort( b, 2, 6 );
+    vector<int> expected{ 9, 8, 3, 4, 5, 6, 7, 2, 1, 0 };
+    if( b != expected )
+        cout << "Oops! subarray heapsort" << endl;
+
+    vector<string> s( 5000 );
+    for( auto & x : s )
+        x = to_string( r.nextInt( ) );
+    introsort( s );
+    checkSorted( s, "introsort strings" );
+    heapsort( s );
+    checkSorted( s, "heapsort strings" );
+
+        // Arithmetic types go through blockPartition
+    for( auto & x : a )
+        x = r.nextInt( );
+    quicksort( a );
+    checkSorted( a, "block quicksort ints" );
+
+    a.assign( NUM_ITEMS, 42 );          // all equal must split evenly
+    quicksort( a );
+    checkSorted( a, "block quicksort all equal" );
+
+    vector<double> d( NUM_ITEMS );
+    for( auto & x : d )
+        x = r.nextDouble( ) - 0.5;
+    quicksort( d );
+    checkSorted( d, "block quicksort doubles" );
+
+    vector<uint64_t> u( NUM_ITEMS );
+    for( auto & x : u )
+        x = static_cast<uint64_t>( r.nextInt( ) ) << 32 | r.nextInt( );
+    introsort( u );
+    checkSorted( u, "block introsort uint64_t" );
+
+    for( int k : { 1, 500, NUM_ITEMS / 2, NUM_ITEMS } )
+    {
+        for( int i = 0; i < NUM_ITEMS; ++i )
+            a[ i ] = ( i * 7919 ) % NUM_ITEMS;  // a permutation of 0..N-1
+        quickSelect( a, k );
+        if( a[ k - 1 ] != k - 1 )
+            cout << "Oops! block quickSelect " << k << endl;
+    }
+
+        // Both schemes must leave a valid partition
+    for( int trial = 0; trial < 100; ++trial )
+    {
+        vector<int> p( 11 + r.nextInt( 1000 ) );
+        for( auto & x : p )
+            x = r.nextInt( 50 );
+        vector<int> q = p;
+        int n = p.size( );
+        int i = hoarePartition( p, 0, n - 1 );
+        int j = blockPartition( q, 0, n - 1 );
+        for( int k = 0; k < n; ++k )
+            if( ( k < i && p[ i ] < p[ k ] ) || ( k > i && p[ k ] < p[ i ] ) ||
+                ( k < j && q[ j ] < q[ k ] ) || ( k > j && q[ k ] < q[ j ] ) )
+            {
+                cout << "Oops! bad partition, trial " << trial << endl;
+                break;
+            }
+    }
+
+    vector<int> empty;
+    introsort( empty );
+    heapsort( empty );
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
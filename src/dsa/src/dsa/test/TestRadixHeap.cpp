@@ -0,0 +1,161 @@
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <utility>
+#include <vector>
+#include "BinaryHeap_sol.H"
+#include "RadixHeap.H"
+#include "UniformRandom.H"
+using namespace std;
+
+    // Interleave monotone inserts with deleteMins and compare
+    // with BinaryHeap; keys are last-removed plus a random step
+template <typename Key>
+void checkAgainstBinaryHeap( UniformRandom & r, int maxStep, const char *name )
+{
+    RadixHeap<Key> h;
+    BinaryHeap<Key> reference;
+    Key lastOut = 0;
+    int count = 0;
+    for( int i = 0; i < 200000; ++i )
+    {
+        if( reference.isEmpty( ) || r.nextInt( 3 ) != 0 )
+        {
+                // Sometimes peek first, as Dijkstra does before relaxing
+            if( !reference.isEmpty( ) && r.nextInt( 4 ) == 0 && h.findMin( ) != reference.findMin( ) )
+                cout << "Oops! " << name << " findMin before insert at " << i << endl;
+            Key x = lastOut + Key( r.nextInt( maxStep ) );
+            h.insert( x );
+            reference.insert( x );
+            ++count;
+        }
+        else
+        {
+            Key x, y;
+            if( h.findMin( ) != reference.findMin( ) )
+                cout << "Oops! " << name << " findMin at " << i << endl;
+            h.deleteMin( x );
+            reference.deleteMin( y );
+            if( x != y )
+                cout << "Oops! " << name << " deleteMin at " << i << endl;
+            lastOut = x;
+            --count;
+        }
+        if( h.size( ) != count )
+        {
+            cout << "Oops! " << name << " size at " << i << endl;
+            return;
+        }
+    }
+    Key x, y;
+    while( !reference.isEmpty( ) )
+    {
+        h.deleteMin( x );
+        reference.deleteMin( y );
+        if( x != y )
+            cout << "Oops! " << name << " drain" << endl;
+    }
+    if( !h.isEmpty( ) )
+        cout << "Oops! " << name << " not empty" << endl;
+}
+
+    // Test program
+int main( )
+{
+    UniformRandom r{ 103 };
+
+    cout << "Begin test... " << endl;
+
+    checkAgainstBinaryHeap<unsigned int>( r, 1000, "unsigned" );
+    checkAgainstBinaryHeap<uint64_t>( r, 1 << 30, "uint64_t" );
+    checkAgainstBinaryHeap<unsigned long long>( r, 3, "unsigned long long" );
+    checkAgainstBinaryHeap<double>( r, 50, "double" );
+
+        // Floats: negatives, zero and fractions, all inserted up front
+    vector<float> floats;
+    for( int i = 0; i < 10000; ++i )
+        floats.push_back( ( r.nextInt( 20000 ) - 10000 ) / 7.0f );
+    RadixHeap<float> fh;
+    for( float f : floats )
+        fh.insert( f );
+    sort( begin( floats ), end( floats ) );
+    for( float f : floats )
+    {
+        float x;
+        fh.deleteMin( x );
+        if( x != f )
+            cout << "Oops! float " << x << " " << f << endl;
+    }
+
+        // Pairs are ordered by their first member only
+    RadixHeap<pair<uint32_t, int>> ph;
+    for( int i = 0; i < 1000; ++i )
+        ph.insert( { uint32_t( i % 10 ), i } );
+    vector<bool> seen( 1000, false );
+    for( int i = 0; i < 1000; ++i )
+    {
+        pair<uint32_t, int> p;
+        ph.deleteMin( p );
+        if( p.first != uint32_t( i / 100 ) || p.first != uint32_t( p.second % 10 ) || seen[ p.second ] )
+            cout << "Oops! pair " << p.first << " " << p.second << endl;
+        seen[ p.second ] = true;
+    }
+
+        // Going below the last key removed is an error
+    RadixHeap<unsigned int> mh;
+    mh.insert( 10 );
+    mh.insert( 20 );
+    mh.deleteMin( );
+    try
+    {
+        mh.insert( 9 );
+        cout << "Oops! non-monotone insert accepted" << endl;
+    }
+    catch( IllegalArgumentException & e )
+    {
+    }
+    mh.insert( 10 );
+    if( mh.findMin( ) != 10 )
+        cout << "Oops! insert at last key" << endl;
+
+        // Peeking does not raise the bar: 15 is below the minimum
+        // found but above the last key removed, as in Dijkstra
+    mh.deleteMin( );
+    if( mh.findMin( ) != 20 )
+        cout << "Oops! findMin after deleteMin" << endl;
+    try
+    {
+        mh.insert( 15 );
+        mh.insert( 12 );
+        mh.insert( 30 );
+    }
+    catch( IllegalArgumentException & e )
+    {
+        cout << "Oops! insert below findMin rejected" << endl;
+    }
+    for( unsigned int want : { 12, 15, 20, 30 } )
+    {
+        unsigned int x;
+        if( mh.findMin( ) != want )
+            cout << "Oops! findMin " << mh.findMin( ) << " wanted " << want << endl;
+        mh.deleteMin( x );
+        if( x != want )
+            cout << "Oops! deleteMin " << x << " wanted " << want << endl;
+    }
+    mh.makeEmpty( );
+    mh.insert( 0 );
+    if( mh.size( ) != 1 || mh.findMin( ) != 0 )
+        cout << "Oops! makeEmpty should reset the last key" << endl;
+    try
+    {
+        RadixHeap<unsigned int> empty;
+        empty.deleteMin( );
+        cout << "Oops! deleteMin on empty heap" << endl;
+    }
+    catch( UnderflowException & e )
+    {
+    }
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
@@ -0,0 +1,170 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include "RadixSort.H"
+#include "UniformRandom.H"
+using namespace std;
+
+template <typename Key>
+void checkAgainstStd( vector<Key> a, const string & what )
+{
+    vector<Key> expected = a;
+    sort( begin( expected ), end( expected ) );
+
+    lsdRadixSort( a );
+    if( a != expected )
+        cout << "Oops! lsdRadixSort " << what << endl;
+}
+
+template <typename Key>
+void checkAgainstStd8( vector<Key> a, const string & what )
+{
+    vector<Key> expected = a;
+    sort( begin( expected ), end( expected ) );
+
+    lsdRadixSort<8>( a );
+    if( a != expected )
+        cout << "Oops! lsdRadixSort<8> " << what << endl;
+}
+
+    // Test program
+int main( )
+{
+    UniformRandom r{ 17 };
+    const int NUM_ITEMS = 100000;
+
+    cout << "Begin test... " << endl;
+
+    vector<int> ints( NUM_ITEMS );
+    for( auto & x : ints )
+        x = r.nextInt( );               // both signs
+    ints[ 0 ] = numeric_limits<int>::min( );
+    ints[ 1 ] = numeric_limits<int>::max( );
+    checkAgainstStd( ints, "int" );
+    checkAgainstStd8( ints, "int" );
+
+    for( auto & x : ints )
+        x = r.nextInt( -50, 50 );       // high digits all equal: passes skipped
+    checkAgainstStd( ints, "small int" );
+
+    vector<unsigned int> uints( NUM_ITEMS );
+    for( auto & x : uints )
+        x = r.nextInt( );
+    checkAgainstStd( uints, "unsigned" );
+
+    vector<int64_t> longs( NUM_ITEMS );
+    vector<uint64_t> ulongs( NUM_ITEMS );
+    for( int i = 0; i < NUM_ITEMS; ++i )
+    {
+        ulongs[ i ] = static_cast<uint64_t>( r.nextInt( ) ) << 32 | r.nextInt( );
+        longs[ i ] = static_cast<int64_t>( ulongs[ i ] );
+    }
+    checkAgainstStd( longs, "int64_t" );
+    checkAgainstStd( ulongs, "uint64_t" );
+    checkAgainstStd8( ulongs, "uint64_t" );
+
+    vector<short> shorts( NUM_ITEMS );
+    for( auto & x : shorts )
+        x = r.nextInt( -30000, 30000 );
+    checkAgainstStd( shorts, "short" );
+
+    vector<double> doubles( NUM_ITEMS );
+    vector<float> floats( NUM_ITEMS );
+    for( int i = 0; i < NUM_ITEMS; ++i )
+    {
+        doubles[ i ] = ( r.nextDouble( ) - 0.5 ) * 1e6;
+        floats[ i ] = static_cast<float>( doubles[ i ] / 1e3 );
+    }
+    doubles[ 0 ] = numeric_limits<double>::infinity( );
+    doubles[ 1 ] = -numeric_limits<double>::infinity( );
+    doubles[ 2 ] = numeric_limits<double>::denorm_min( );
+    doubles[ 3 ] = -0.0;
+    doubles[ 4 ] = 0.0;
+    checkAgainstStd( doubles, "double" );
+    checkAgainstStd( floats, "float" );
+
+    vector<double> zeros{ 0.0, -0.0, 1.0, -1.0, -0.0 };
+    lsdRadixSort( zeros );
+    if( !signbit( zeros[ 1 ] ) || !signbit( zeros[ 2 ] ) || signbit( zeros[ 3 ] ) )
+        cout << "Oops! -0.0 should precede 0.0" << endl;
+
+    vector<int> same( 1000, 7 );
+    checkAgainstStd( same, "all equal" );
+
+    vector<int> empty;
+    lsdRadixSort( empty );
+
+        // Variable-length strings with shared prefixes and non-ASCII bytes
+    vector<string> strs;
+    const string prefixes[ ] = { "", "http://", "http://www.example.com/", "\xc3\xa9t\xc3\xa9" };
+    for( int i = 0; i < 20000; ++i )
+    {
+        string s = prefixes[ r.nextInt( 4 ) ];
+        int len = r.nextInt( 0, r.nextInt( 2 ) == 0 ? 5 : 300 );
+        for( int j = 0; j < len; ++j )
+            s += static_cast<char>( r.nextInt( 2 ) == 0 ? 'a' + r.nextInt( 3 ) : r.nextInt( 1, 255 ) );
+        strs.push_back( s );
+        if( i % 10 == 0 )
+            strs.push_back( s );              // duplicates
+    }
+    vector<string> expected = strs;
+    sort( begin( expected ), end( expected ) );
+
+    vector<string> b = strs;
+    msdRadixSort( b );
+    if( b != expected )
+        cout << "Oops! msdRadixSort" << endl;
+
+    b = strs;
+    multikeyQuicksort( b );
+    if( b != expected )
+        cout << "Oops! multikeyQuicksort" << endl;
+
+    b = strs;
+    prefixRadixSort( b );
+    if( b != expected )
+        cout << "Oops! prefixRadixSort" << endl;
+
+        // Embedded zero bytes must still sort after the shorter string
+    vector<string> zeroes{ string( "ab\0", 3 ), "ab", string( "abcdefgh\0", 9 ),
+                           "abcdefgh", string( 20, 'x' ), string( 19, 'x' ), "" };
+    for( int k = 0; k < 100; ++k )          // big enough to skip the cutoff
+        zeroes.push_back( zeroes[ k % 7 ] );
+    expected = zeroes;
+    sort( begin( expected ), end( expected ) );
+    prefixRadixSort( zeroes );
+    if( zeroes != expected )
+        cout << "Oops! prefixRadixSort with zero bytes" << endl;
+
+        // The book's LSD string sorts now handle bytes above 127
+    vector<string> fixed( 5000 );
+    for( auto & s : fixed )
+        for( int j = 0; j < 6; ++j )
+            s += static_cast<char>( r.nextInt( 1, 255 ) );
+    expected = fixed;
+    sort( begin( expected ), end( expected ) );
+    b = fixed;
+    countingRadixSort( b, 6 );
+    if( b != expected )
+        cout << "Oops! countingRadixSort" << endl;
+    b = fixed;
+    radixSortA( b, 6 );
+    if( b != expected )
+        cout << "Oops! radixSortA" << endl;
+    b = fixed;
+    radixSort( b, 6 );
+    if( b != expected )
+        cout << "Oops! radixSort" << endl;
+
+    vector<string> noStrings;
+    msdRadixSort( noStrings );
+    multikeyQuicksort( noStrings );
+    prefixRadixSort( noStrings );
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <vector>
+#include "ExternalSort.H"
+#include "ReplacementSelection.H"
+#include "UniformRandom.H"
+using namespace std;
+
+struct Record
+{
+    int key;
+    int seq;
+
+    bool operator<( const Record & rhs ) const
+      { return key < rhs.key; }
+};
+
+    // Push input through a RunGenerator of the given capacity
+vector<vector<Record>> makeRuns( const vector<Record> & input, int capacity )
+{
+    vector<vector<Record>> runs( 1 );
+    RunGenerator<Record> gen( capacity,
+        [ & ]( const Record & x ) { runs.back( ).push_back( x ); },
+        [ & ]( ) { runs.emplace_back( ); } );
+    for( auto & x : input )
+        gen.push( x );
+    gen.finish( );
+    runs.pop_back( );
+
+    if( size_t( gen.numRuns( ) ) != runs.size( ) || size_t( gen.numRecords( ) ) != input.size( ) )
+        cout << "Oops! bad run counters" << endl;
+    return runs;
+}
+
+    // Every run is sorted and stable; together they hold the input
+void checkRuns( const vector<vector<Record>> & runs, const vector<Record> & input )
+{
+    vector<int> seen( input.size( ), 0 );
+    for( auto & run : runs )
+    {
+        if( run.empty( ) )
+            cout << "Oops! empty run" << endl;
+        for( size_t i = 0; i < run.size( ); ++i )
+        {
+            ++seen[ run[ i ].seq ];
+            if( i > 0 && ( run[ i ] < run[ i - 1 ] ||
+                ( run[ i ].key == run[ i - 1 ].key && run[ i ].seq < run[ i - 1 ].seq ) ) )
+            {
+                cout << "Oops! run out of order at " << i << endl;
+                return;
+            }
+        }
+    }
+    if( size_t( count( begin( seen ), end( seen ), 1 ) ) != input.size( ) )
+        cout << "Oops! runs lost or duplicated records" << endl;
+}
+
+    // Test program
+int main( )
+{
+    UniformRandom r{ 31 };
+    const int NUM_ITEMS = 200000;
+    const int CAPACITY = 1000;
+
+    cout << "Begin test... " << endl;
+
+    vector<Record> input( NUM_ITEMS );
+    for( int i = 0; i < NUM_ITEMS; ++i )
+        input[ i ] = Record{ r.nextInt( ), i };
+    vector<vector<Record>> runs = makeRuns( input, CAPACITY );
+    checkRuns( runs, input );
+    double average = static_cast<double>( NUM_ITEMS ) / runs.size( );
+    if( average < 1.8 * CAPACITY || average > 2.2 * CAPACITY )
+        cout << "Oops! random runs average " << average << endl;
+
+    for( int i = 0; i < NUM_ITEMS; ++i )
+        input[ i ] = Record{ r.nextInt( 50 ), i };     // many equal keys
+    checkRuns( makeRuns( input, CAPACITY ), input );
+
+    for( int i = 0; i < NUM_ITEMS; ++i )
+        input[ i ] = Record{ i, i };
+    if( makeRuns( input, CAPACITY ).size( ) != 1 )
+        cout << "Oops! sorted input should give one run" << endl;
+
+    for( int i = 0; i < NUM_ITEMS; ++i )
+        input[ i ] = Record{ NUM_ITEMS - i, i };
+    runs = makeRuns( input, CAPACITY );
+    checkRuns( runs, input );
+    if( runs.size( ) != NUM_ITEMS / CAPACITY )
+        cout << "Oops! reversed input should give runs of the capacity" << endl;
+
+    input.resize( 10 );
+    checkRuns( makeRuns( input, CAPACITY ), input );
+    input.clear( );
+    if( !makeRuns( input, CAPACITY ).empty( ) )
+        cout << "Oops! empty input made a run" << endl;
+
+        // ExternalSorter with replacement selection stays sorted and stable
+    const char *inName = "/tmp/TestReplacementSelection.in";
+    const char *outName = "/tmp/TestReplacementSelection.out";
+    input.resize( NUM_ITEMS );
+    for( int i = 0; i < NUM_ITEMS; ++i )
+        input[ i ] = Record{ r.nextInt( 1000 ), i };
+    {
+        ofstream out( inName, ios::binary );
+        out.write( reinterpret_cast<const char *>( input.data( ) ), NUM_ITEMS * sizeof( Record ) );
+    }
+
+    ExternalSorter<Record> chunked( 1 << 16, "/tmp", 4 );
+    chunked.sort( inName, outName );
+    ExternalSorter<Record> sorter( 1 << 16, "/tmp", 4 );
+    sorter.setReplacementSelection( true );
+    sorter.sort( inName, outName );
+
+    vector<Record> sorted( NUM_ITEMS + 1 );
+    ifstream in( outName, ios::binary );
+    in.read( reinterpret_cast<char *>( sorted.data( ) ), sorted.size( ) * sizeof( Record ) );
+    if( in.gcount( ) != NUM_ITEMS * sizeof( Record ) )
+        cout << "Oops! wrong output size" << endl;
+    sorted.pop_back( );
+    stable_sort( begin( input ), end( input ) );
+    for( int i = 0; i < NUM_ITEMS; ++i )
+        if( sorted[ i ].key != input[ i ].key || sorted[ i ].seq != input[ i ].seq )
+        {
+            cout << "Oops! replacement selection sort differs at " << i << endl;
+            break;
+        }
+    if( sorter.stats( ).runs >= chunked.stats( ).runs )
+        cout << "Oops! expected fewer runs: " << sorter.stats( ).runs
+             << " vs " << chunked.stats( ).runs << endl;
+
+    remove( inName );
+    remove( outName );
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
@@ -0,0 +1,60 @@
+#include <iostream>
+#include <string>
+#include "SeparateChaining_sol.H"
+#include "HashTableChecks.H"
+using namespace std;
+
+template <typename Sizing>
+void checkTextbook( const string & what )
+{
+    HashTable<int, Sizing> h1;
+    HashTable<int, Sizing> h2;
+
+    const int NUMS = 400000;
+    const int GAP  =   37;
+    int i;
+
+    for( i = GAP; i != 0; i = ( i + GAP ) % NUMS )
+        h1.insert( i );
+
+    h2 = h1;
+
+    for( i = 1; i < NUMS; i += 2 )
+        h2.remove( i );
+
+    for( i = 2; i < NUMS; i += 2 )
+        if( !h2.contains( i ) )
+            cout << "Oops! " << what << " contains fails " << i << endl;
+
+    for( i = 1; i < NUMS; i += 2 )
+        if( h2.contains( i ) )
+            cout << "Oops! " << what << " " << i << endl;
+}
+
+    // Test program
+int main( )
+{
+    cout << "Begin test... " << endl;
+
+    checkTextbook<PrimeSizing>( "prime" );
+    checkTextbook<PowerOfTwoSizing>( "power of 2" );
+    checkTextbook<FastRangeSizing>( "fast range" );
+
+    auto intKey = [ ]( int k ) { return k; };
+    auto stringKey = [ ]( int k ) { return "key" + to_string( k ); };
+    checkRandom<HashTable<int, PrimeSizing>>( intKey, 300000, 3000, "int" );
+    checkRandom<HashTable<int, PowerOfTwoSizing>>( intKey, 300000, 3000, "power of 2 int" );
+    checkRandom<HashTable<int, FastRangeSizing>>( intKey, 300000, 3000, "fast range int" );
+    checkRandom<HashTable<string, PowerOfTwoSizing>>( stringKey, 200000, 2000, "power of 2 string" );
+
+    typedef HashTable<int, PrimeSizing> IntTable;
+    typedef HashTable<string, PowerOfTwoSizing> StringTable;
+    checkRandom<IntTable>( intKey, 600000, 20000, "incremental int", 101, IntTable::INCREMENTAL );
+    checkRandom<StringTable>( stringKey, 300000, 10000, "incremental string",
+                              101, StringTable::INCREMENTAL );
+    checkGrowth<HashTable<int, PrimeSizing>>( "growth" );
+    checkGrowth<HashTable<int, PowerOfTwoSizing>>( "power of 2 growth" );
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}
@@ -0,0 +1,65 @@
+#include <iostream>
+#include <string>
+#include "SwissHashTable.H"
+#include "HashTableChecks.H"
+using namespace std;
+
+    // Test program
+int main( )
+{
+    SwissHashTable<int> h1;
+    SwissHashTable<int> h2;
+
+    const int NUMS = 400000;
+    const int GAP  =   37;
+    int i;
+
+    cout << "Begin test... " << endl;
+
+    for( i = GAP; i != 0; i = ( i + GAP ) % NUMS )
+        h1.insert( i );
+    if( h1.size( ) != NUMS - 1 || h1.insert( GAP ) )
+        cout << "Oops! size after inserts" << endl;
+
+    h2 = h1;
+
+    for( i = 1; i < NUMS; i += 2 )
+        if( !h2.remove( i ) )
+            cout << "Oops! remove fails " << i << endl;
+
+    for( i = 2; i < NUMS; i += 2 )
+        if( !h2.contains( i ) )
+            cout << "Oops! contains fails " << i << endl;
+
+    for( i = 1; i < NUMS; i += 2 )
+        if( h2.contains( i ) || !h1.contains( i ) )
+            cout << "Oops! " << i << endl;
+
+    h2.makeEmpty( );
+    if( h2.size( ) != 0 || h2.contains( 2 ) )
+        cout << "Oops! makeEmpty" << endl;
+
+        // Churn at a constant size: deleted slots must be reclaimed
+        // without the table growing without bound
+    SwissHashTable<int> churn{ 1000 };
+    for( i = 0; i < 1000; ++i )
+        churn.insert( i );
+    for( i = 1000; i < 2000000; ++i )
+    {
+        churn.remove( i - 1000 );
+        churn.insert( i );
+    }
+    for( i = 2000000 - 1000; i < 2000000; ++i )
+        if( !churn.contains( i ) )
+            cout << "Oops! churn lost " << i << endl;
+    if( churn.size( ) != 1000 || churn.contains( 0 ) )
+        cout << "Oops! churn size" << endl;
+
+    checkRandom<SwissHashTable<int>>( [ ]( int k ) { return k; }, 300000, 5000, "int", 1 );
+    checkRandom<SwissHashTable<int>>( [ ]( int k ) { return k * 4096; }, 300000, 50000, "int stride", 1 );
+    checkRandom<SwissHashTable<string>>( [ ]( int k ) { return "key" + to_string( k ); },
+                                         200000, 3000, "string", 1 );
+
+    cout << "End test... no other output is good" << endl;
+    return 0;
+}